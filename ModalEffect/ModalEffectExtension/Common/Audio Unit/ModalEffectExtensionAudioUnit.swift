@@ -84,7 +84,7 @@ public class ModalEffectExtensionAudioUnit: AUAudioUnit, @unchecked Sendable {
         // Set default values from parameter tree
         if let paramTree = _parameterTree {
             for param in paramTree.allParameters {
-                modal_attractors_engine_set_parameter(engine, UInt32(param.address), param.value)
+                applyParameter(param.address, param.value)
             }
             setupParameterCallbacks(paramTree)
         }
@@ -113,6 +113,12 @@ public class ModalEffectExtensionAudioUnit: AUAudioUnit, @unchecked Sendable {
         set { _parameterTree = newValue }
     }
 
+    /// Dry path delay of the onset lookahead, for host delay compensation
+    public override var latency: TimeInterval {
+        guard let engine = engine, let bus = outputBus, bus.format.sampleRate > 0 else { return 0 }
+        return Double(modal_attractors_engine_get_latency(engine)) / bus.format.sampleRate
+    }
+
     public override var maximumFramesToRender: AUAudioFrameCount {
         get {
             return super.maximumFramesToRender
@@ -138,8 +144,8 @@ public class ModalEffectExtensionAudioUnit: AUAudioUnit, @unchecked Sendable {
         // Called when a parameter changes (from UI or host automation)
         // NOTE: this is not sample-accurate; sample-accurate automation comes via render events.
         paramTree.implementorValueObserver = { [weak self] param, value in
-            guard let self = self, let engine = self.engine else { return }
-            modal_attractors_engine_set_parameter(engine, UInt32(param.address), value)
+            guard let self = self else { return }
+            self.applyParameter(param.address, value)
         }
 
         // Called when the value needs to be read
@@ -169,6 +175,23 @@ public class ModalEffectExtensionAudioUnit: AUAudioUnit, @unchecked Sendable {
         }
     }
 
+    /// Forward a parameter value to the engine. The lookahead changes the
+    /// latency, so hosts observing it via KVO are notified around that change.
+    private func applyParameter(_ address: AUParameterAddress, _ value: AUValue) {
+        guard let engine = engine else { return }
+
+        let paramID = UInt32(address)
+        guard address == ModalEffectExtensionParameterAddress.param_Lookahead.rawValue,
+              value != modal_attractors_engine_get_parameter(engine, paramID) else {
+            modal_attractors_engine_set_parameter(engine, paramID, value)
+            return
+        }
+
+        willChangeValue(forKey: "latency")
+        modal_attractors_engine_set_parameter(engine, paramID, value)
+        didChangeValue(forKey: "latency")
+    }
+
     private func ensureParameterTree() -> AUParameterTree {
         if let paramTree = _parameterTree {
             return paramTree
@@ -177,9 +200,9 @@ public class ModalEffectExtensionAudioUnit: AUAudioUnit, @unchecked Sendable {
         let paramTree = ModalEffectExtensionParameterSpecs.createAUParameterTree()
         _parameterTree = paramTree
 
-        if let engine = engine {
+        if engine != nil {
             for param in paramTree.allParameters {
-                modal_attractors_engine_set_parameter(engine, UInt32(param.address), param.value)
+                applyParameter(param.address, param.value)
             }
         }
 
@@ -383,17 +406,13 @@ public class ModalEffectExtensionAudioUnit: AUAudioUnit, @unchecked Sendable {
             return state
         }
         set {
-            guard let engine = engine, let newState = newValue else { return }
+            guard engine != nil, let newState = newValue else { return }
 
             // Restore parameter values
             if let paramTree = parameterTree {
                 for param in paramTree.allParameters {
                     if let value = newState[param.identifier] as? Float {
-                        modal_attractors_engine_set_parameter(
-                            engine,
-                            UInt32(param.address),
-                            value
-                        )
+                        applyParameter(param.address, value)
                         param.value = value
                     }
                 }
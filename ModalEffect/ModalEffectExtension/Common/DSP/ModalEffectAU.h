@@ -16,10 +16,35 @@
 
 #include <cstdint>
 
+// Longest lookahead (dry delay) in milliseconds
+#define MODAL_ENGINE_MAX_LOOKAHEAD_MS 50.0
+
+// Parameter id of the lookahead in milliseconds (kParam_Lookahead); handled
+// by the engine itself, changes the reported latency
+#define MODAL_ENGINE_PARAM_LOOKAHEAD 5
+
+// Onsets waiting for the delayed dry signal to reach them
+#define MODAL_ENGINE_MAX_PENDING_ONSETS 16
+
+/**
+ * @brief How effect-mode onsets are spread over the 5-node network
+ */
+typedef enum {
+    MODAL_ONSET_ROUTING_SINGLE = 0,    // Every onset on node 0 (default)
+    MODAL_ONSET_ROUTING_ROUND_ROBIN,   // Successive onsets on successive nodes
+    MODAL_ONSET_ROUTING_PITCH_ZONES,   // Node by target note (low notes → node 0)
+    MODAL_ONSET_ROUTING_PER_BAND       // Node by onset brightness (dark → node 0)
+} modal_onset_routing_t;
+
 // Forward declaration - actual definition in SynthEngine.h
 class SynthEngine;
 class EventQueue;
 
+// Forward declarations - actual definitions in PitchTracker.h / OnsetDetector.h
+struct pitch_tracker;
+struct onset_detector;
+struct onset_event;
+
 /**
  * @brief Opaque engine handle
  *
@@ -37,18 +62,26 @@ struct ModalEffectEngine {
     uint32_t buffer_size;  // Allocated buffer size
 
     // Effect state tracking
-    float last_energy;        // Previous frame energy for onset detection
-    float smoothed_energy;    // Smoothed energy for continuous excitation
+    struct onset_detector* onset_detector;  // Streaming onset detection (64-sample hops)
+    struct onset_event* pending_onsets;     // Due after lookahead (MODAL_ENGINE_MAX_PENDING_ONSETS)
+    uint32_t num_pending_onsets;  // Queued pending onsets
     uint8_t current_note;     // Currently playing note (for note-off)
     bool note_is_on;          // Whether a note is currently active
-    float energy_threshold;   // Adaptive threshold for onset detection
+    modal_onset_routing_t onset_routing;  // Node allocation for onsets
 
     // Pitch detection state
-    float* pitch_buffer;      // Circular buffer for pitch detection
-    uint32_t pitch_buf_size;  // Pitch detection buffer size
-    uint32_t pitch_buf_pos;   // Current position in pitch buffer
+    struct pitch_tracker* pitch_tracker;  // Shared incremental pitch tracker
     float detected_pitch_hz;  // Last detected pitch in Hz
     double sample_rate;       // Current sample rate
+
+    // Lookahead: the dry path is delayed so notes can start with the attack
+    float* dry_delay_l;       // Left dry delay line (max lookahead)
+    float* dry_delay_r;       // Right dry delay line (max lookahead)
+    uint32_t dry_delay_capacity;  // Allocated delay line length
+    uint32_t dry_delay_pos;   // Delay line read/write position
+    uint32_t lookahead_samples;   // Current dry delay
+    uint32_t requested_lookahead_samples;  // Dry delay from the next process call (reported latency)
+    float lookahead_ms;       // Requested lookahead in milliseconds
 };
 
 // ============================================================================
@@ -136,6 +169,10 @@ void modal_attractors_engine_push_pitch_bend(ModalEffectEngine* engine,
 
 /**
  * @brief Push parameter change event
+ *
+ * MODAL_ENGINE_PARAM_LOOKAHEAD is not automatable (it changes the latency)
+ * and is ignored here; use set_parameter() or set_lookahead().
+ *
  * @param sample_offset Sample offset in current buffer
  * @param param_id Parameter ID
  * @param value Parameter value
@@ -186,13 +223,93 @@ void modal_attractors_engine_process(ModalEffectEngine* engine,
                                      float* outR,
                                      uint32_t num_frames);
 
+// ============================================================================
+// Onset handling (effect mode)
+// ============================================================================
+
+/**
+ * @brief Set lookahead (dry path delay) for onset detection
+ *
+ * Delays the dry signal so onsets are detected ahead of it and their notes
+ * start aligned with the attack in the output instead of after it. The
+ * delay is reported through modal_attractors_engine_get_latency(); 0
+ * disables lookahead (default). Clamped to MODAL_ENGINE_MAX_LOOKAHEAD_MS
+ * and kept across sample rate changes. Also reachable as parameter
+ * MODAL_ENGINE_PARAM_LOOKAHEAD.
+ *
+ * The latency changes immediately; the delay itself switches (restarting
+ * from silence) at the start of the next process call, on the render
+ * thread, so this may be called while rendering.
+ *
+ * @param engine Engine handle
+ * @param lookahead_ms Lookahead in milliseconds
+ */
+void modal_attractors_engine_set_lookahead(ModalEffectEngine* engine, float lookahead_ms);
+
+/**
+ * @brief Get processing latency for host delay compensation
+ * @param engine Engine handle
+ * @return Latency in samples at the current sample rate (the requested
+ *         lookahead, in effect from the next process call)
+ */
+uint32_t modal_attractors_engine_get_latency(const ModalEffectEngine* engine);
+
+/**
+ * @brief Set how onsets are allocated to the network nodes
+ *
+ * With SINGLE every onset retriggers one node. The other strategies put
+ * successive transients on separate nodes (through the node manager's
+ * note routing), where each keeps ringing with its own decay after the
+ * next onset releases it. Call outside render.
+ *
+ * @param engine Engine handle
+ * @param routing Allocation strategy
+ */
+void modal_attractors_engine_set_onset_routing(ModalEffectEngine* engine,
+                                               modal_onset_routing_t routing);
+
+// ============================================================================
+// Control rate
+// ============================================================================
+
+/**
+ * @brief Set the control (modal integration) rate of the node network
+ *
+ * Lower rates cost proportionally fewer modal steps but step the mode
+ * amplitudes more coarsely; combine with amplitude interpolation below
+ * ~500 Hz to avoid zipper noise. Kept across prepare(). Call outside render.
+ *
+ * @param engine Engine handle
+ * @param rate_hz Control ticks per second (default CONTROL_RATE_HZ, 500 Hz)
+ */
+void modal_attractors_engine_set_control_rate(ModalEffectEngine* engine, double rate_hz);
+
+/**
+ * @brief Get the control rate in Hz
+ */
+double modal_attractors_engine_get_control_rate(const ModalEffectEngine* engine);
+
+/**
+ * @brief Ramp mode amplitudes linearly across each control tick
+ *
+ * Off (default): one-pole amplitude smoothing per sample. On: linear ramps
+ * from tick to tick, which keeps low control rates free of zipper noise.
+ * Call outside render.
+ *
+ * @param engine Engine handle
+ * @param enabled Use linear tick interpolation
+ */
+void modal_attractors_engine_set_amplitude_interpolation(ModalEffectEngine* engine,
+                                                         bool enabled);
+
 // ============================================================================
 // Parameter access (for host automation)
 // ============================================================================
 
 /**
  * @brief Set parameter immediately (not sample-accurate)
- * Use push_parameter for sample-accurate automation
+ * Use push_parameter for sample-accurate automation.
+ * MODAL_ENGINE_PARAM_LOOKAHEAD sets the lookahead (see set_lookahead()).
  */
 void modal_attractors_engine_set_parameter(ModalEffectEngine* engine,
                                            uint32_t param_id,
@@ -8,12 +8,60 @@
 
 #include "ModalEffectAU.h"
 #include "../../DSP/SynthEngine.h"
+#include "../../DSP/NodeManager.h"
+#include "../../DSP/DenormalGuard.h"
+#include "../../DSP/OnsetDetector.h"
+#include "../../DSP/PitchTracker.h"
 #include <cstring>
 
 // ============================================================================
 // Initialization and cleanup
 // ============================================================================
 
+// Pitch tracker at the engine's sample rate (allocates, not real-time safe)
+static void init_pitch_tracker(ModalEffectEngine* engine) {
+    pitch_tracker_init(engine->pitch_tracker, static_cast<float>(engine->sample_rate),
+                       60.0f, 2000.0f, 50.0f, 100.0f);
+    pitch_tracker_set_hop(engine->pitch_tracker,
+                          static_cast<uint32_t>(engine->sample_rate * 0.02), true);  // 20ms
+}
+
+// Dry delay lines for the longest lookahead at the engine's sample rate
+static void alloc_dry_delay(ModalEffectEngine* engine) {
+    engine->dry_delay_capacity =
+        static_cast<uint32_t>(engine->sample_rate * MODAL_ENGINE_MAX_LOOKAHEAD_MS * 0.001) + 1;
+    engine->dry_delay_l = new float[engine->dry_delay_capacity];
+    engine->dry_delay_r = new float[engine->dry_delay_capacity];
+}
+
+static void free_dry_delay(ModalEffectEngine* engine) {
+    delete[] engine->dry_delay_l;
+    delete[] engine->dry_delay_r;
+    engine->dry_delay_l = nullptr;
+    engine->dry_delay_r = nullptr;
+    engine->dry_delay_capacity = 0;
+}
+
+// Convert the requested lookahead to samples at the engine's sample rate
+static void request_lookahead(ModalEffectEngine* engine) {
+    uint32_t samples = static_cast<uint32_t>(engine->lookahead_ms * 0.001 * engine->sample_rate + 0.5);
+    if (samples >= engine->dry_delay_capacity) {
+        samples = engine->dry_delay_capacity - 1;
+    }
+
+    // Written by set_lookahead() off the render thread, read by process()
+    __atomic_store_n(&engine->requested_lookahead_samples, samples, __ATOMIC_RELAXED);
+}
+
+// Switch to the requested lookahead, starting from a silent delay
+static void apply_lookahead(ModalEffectEngine* engine) {
+    engine->lookahead_samples = __atomic_load_n(&engine->requested_lookahead_samples, __ATOMIC_RELAXED);
+    engine->dry_delay_pos = 0;
+    memset(engine->dry_delay_l, 0, engine->dry_delay_capacity * sizeof(float));
+    memset(engine->dry_delay_r, 0, engine->dry_delay_capacity * sizeof(float));
+    engine->num_pending_onsets = 0;
+}
+
 void modal_attractors_engine_init(ModalEffectEngine* engine,
                                   double sample_rate,
                                   uint32_t max_frames,
@@ -34,18 +82,25 @@ void modal_attractors_engine_init(ModalEffectEngine* engine,
     memset(engine->wetR, 0, max_frames * sizeof(float));
 
     // Initialize effect state
-    engine->last_energy = 0.0f;
-    engine->smoothed_energy = 0.0f;
     engine->current_note = 60;  // C4
     engine->note_is_on = false;
-    engine->energy_threshold = 0.01f;
     engine->sample_rate = sample_rate;
 
-    // Allocate pitch detection buffer (100ms window)
-    engine->pitch_buf_size = static_cast<uint32_t>(sample_rate * 0.1);  // 100ms
-    engine->pitch_buffer = new float[engine->pitch_buf_size];
-    memset(engine->pitch_buffer, 0, engine->pitch_buf_size * sizeof(float));
-    engine->pitch_buf_pos = 0;
+    // Analysis state (kept out of the bridging header)
+    engine->onset_detector = new onset_detector_t;
+    engine->pending_onsets = new onset_event_t[MODAL_ENGINE_MAX_PENDING_ONSETS];
+    engine->pitch_tracker = new pitch_tracker_t;
+
+    // Onset detection on 64-sample hops, independent of the host buffer
+    onset_detector_init(engine->onset_detector, static_cast<float>(sample_rate), 64);
+
+    // No lookahead until requested
+    alloc_dry_delay(engine);
+    request_lookahead(engine);
+    apply_lookahead(engine);
+
+    // Pitch tracking (50ms window, one analysis stage per render callback)
+    init_pitch_tracker(engine);
     engine->detected_pitch_hz = 261.63f;  // C4 default
 
     // Prepare engine for processing
@@ -70,15 +125,16 @@ void modal_attractors_engine_prepare(ModalEffectEngine* engine,
         memset(engine->wetR, 0, max_frames * sizeof(float));
     }
 
-    // Reallocate pitch buffer if sample rate changed
-    uint32_t new_pitch_buf_size = static_cast<uint32_t>(sample_rate * 0.1);  // 100ms
+    // Rebuild pitch tracker, onset detector and dry delay if sample rate changed
     if (sample_rate != engine->sample_rate) {
-        delete[] engine->pitch_buffer;
-        engine->pitch_buf_size = new_pitch_buf_size;
-        engine->pitch_buffer = new float[engine->pitch_buf_size];
-        memset(engine->pitch_buffer, 0, engine->pitch_buf_size * sizeof(float));
-        engine->pitch_buf_pos = 0;
+        pitch_tracker_cleanup(engine->pitch_tracker);
+        free_dry_delay(engine);
         engine->sample_rate = sample_rate;
+        init_pitch_tracker(engine);
+        onset_detector_init(engine->onset_detector, static_cast<float>(sample_rate), 64);
+        alloc_dry_delay(engine);
+        request_lookahead(engine);
+        apply_lookahead(engine);
     }
 
     engine->synth_engine->prepare(sample_rate, max_frames, 2);
@@ -88,6 +144,10 @@ void modal_attractors_engine_reset(ModalEffectEngine* engine) {
     if (!engine || !engine->initialized) return;
 
     engine->synth_engine->reset();
+    pitch_tracker_reset(engine->pitch_tracker);
+    onset_detector_reset(engine->onset_detector);
+    apply_lookahead(engine);
+    engine->note_is_on = false;
 }
 
 void modal_attractors_engine_cleanup(ModalEffectEngine* engine) {
@@ -113,13 +173,25 @@ void modal_attractors_engine_cleanup(ModalEffectEngine* engine) {
         engine->wetR = nullptr;
     }
 
-    if (engine->pitch_buffer) {
-        delete[] engine->pitch_buffer;
-        engine->pitch_buffer = nullptr;
+    if (engine->pitch_tracker) {
+        pitch_tracker_cleanup(engine->pitch_tracker);
+        delete engine->pitch_tracker;
+        engine->pitch_tracker = nullptr;
+    }
+
+    if (engine->onset_detector) {
+        delete engine->onset_detector;
+        engine->onset_detector = nullptr;
+    }
+
+    if (engine->pending_onsets) {
+        delete[] engine->pending_onsets;
+        engine->pending_onsets = nullptr;
     }
 
+    free_dry_delay(engine);
+
     engine->buffer_size = 0;
-    engine->pitch_buf_size = 0;
     engine->initialized = false;
 }
 
@@ -183,6 +255,9 @@ void modal_attractors_engine_push_parameter(ModalEffectEngine* engine,
                                             float value) {
     if (!engine || !engine->initialized) return;
 
+    // Lookahead changes the latency: not automatable
+    if (param_id == MODAL_ENGINE_PARAM_LOOKAHEAD) return;
+
     SynthEvent event;
     event.type = EventType::Parameter;
     event.sampleOffset = sample_offset;
@@ -213,21 +288,17 @@ void modal_attractors_engine_render(ModalEffectEngine* engine,
     engine->synth_engine->render(*engine->event_queue, outL, outR, num_frames);
 }
 
-// Simple pitch detection using zero-crossing rate
-static float detect_pitch_zcr(const float* buffer, uint32_t size, float sample_rate) {
-    // Count zero crossings
-    uint32_t crossings = 0;
-    for (uint32_t i = 1; i < size; ++i) {
-        if ((buffer[i-1] >= 0.0f && buffer[i] < 0.0f) ||
-            (buffer[i-1] < 0.0f && buffer[i] >= 0.0f)) {
-            crossings++;
+// Pitch to follow: the tracker's YIN pitch, else the zero-crossing estimate
+// while there is signal, else the previous pitch
+static float track_pitch(ModalEffectEngine* engine) {
+    float freq = pitch_tracker_get_pitch(engine->pitch_tracker);
+    if (freq <= 0.0f) {
+        if (pitch_tracker_get_rms(engine->pitch_tracker) < 0.001f) {
+            return engine->detected_pitch_hz;
         }
+        freq = pitch_tracker_get_zcr_pitch(engine->pitch_tracker);
     }
 
-    // Estimate frequency from zero-crossing rate
-    // Each crossing is half a cycle
-    float freq = (crossings * sample_rate) / (2.0f * size);
-
     // Constrain to reasonable range (60 Hz - 2000 Hz)
     if (freq < 60.0f) freq = 60.0f;
     if (freq > 2000.0f) freq = 2000.0f;
@@ -235,6 +306,13 @@ static float detect_pitch_zcr(const float* buffer, uint32_t size, float sample_r
     return freq;
 }
 
+// Per-band routing: log-spaced brightness bands from 100 Hz, one per node
+static uint8_t onset_band(float centroid_hz) {
+    const float bands_per_octave = NUM_NETWORK_NODES / 6.0f;  // 100 Hz - 6.4 kHz
+    float band = log2f(fmaxf(centroid_hz, 100.0f) / 100.0f) * bands_per_octave;
+    return static_cast<uint8_t>(fminf(band, NUM_NETWORK_NODES - 1));
+}
+
 // Convert frequency in Hz to MIDI note number
 static uint8_t hz_to_midi(float hz) {
     // MIDI note = 69 + 12 * log2(hz / 440)
@@ -260,6 +338,14 @@ void modal_attractors_engine_process(ModalEffectEngine* engine,
         return;
     }
 
+    // Analysis and rendering decay into silence: flush denormals to zero
+    DenormalGuard denormal_guard;
+
+    // A lookahead change takes effect here, between buffers
+    if (__atomic_load_n(&engine->requested_lookahead_samples, __ATOMIC_RELAXED) != engine->lookahead_samples) {
+        apply_lookahead(engine);
+    }
+
     // Get effect parameters
     float bodySize = engine->synth_engine->getParameter(0);  // kParam_BodySize = 0
     float material = engine->synth_engine->getParameter(1);  // kParam_Material = 1
@@ -270,33 +356,34 @@ void modal_attractors_engine_process(ModalEffectEngine* engine,
     float dryGain = 1.0f - mix;
     float wetGain = mix;
 
-    // Calculate input energy (RMS over buffer)
-    float energy = 0.0f;
+    // Mono input; goes through wetL, which is free until the wet signal is rendered
+    float* mono = engine->wetL;
     for (uint32_t i = 0; i < num_frames; ++i) {
-        float sample = (inL[i] + inR[i]) * 0.5f;
-
-        // Fill pitch detection buffer
-        engine->pitch_buffer[engine->pitch_buf_pos] = sample;
-        engine->pitch_buf_pos = (engine->pitch_buf_pos + 1) % engine->pitch_buf_size;
-
-        energy += sample * sample;
+        mono[i] = (inL[i] + inR[i]) * 0.5f;
     }
-    energy = sqrtf(energy / num_frames);
 
-    // Smooth energy for continuous excitation
-    const float energy_smooth = 0.95f;
-    engine->smoothed_energy = engine->smoothed_energy * energy_smooth + energy * (1.0f - energy_smooth);
-
-    // Detect onsets (energy rising above threshold)
-    float energyDelta = energy - engine->last_energy;
-    engine->last_energy = energy;
-
-    // Adaptive threshold based on smoothed energy
-    float threshold = 0.005f + engine->smoothed_energy * 0.5f;
+    // Feed the pitch tracker and advance its analysis schedule
+    pitch_tracker_push(engine->pitch_tracker, mono, num_frames);
+    pitch_tracker_update(engine->pitch_tracker);
+
+    // Detect onsets and releases at their sample positions (excite scales the
+    // thresholds); the detector's position is the first sample of this buffer
+    const uint64_t buffer_start = engine->onset_detector->position;
+    onset_event_t onsets[ONSET_MAX_EVENTS];
+    onset_detector_set_threshold(engine->onset_detector, excite);
+    uint32_t num_onsets = onset_detector_process(engine->onset_detector, mono, num_frames,
+                                                 onsets, ONSET_MAX_EVENTS);
+
+    // Each event is due when the (delayed) dry signal reaches it
+    for (uint32_t e = 0; e < num_onsets; ++e) {
+        if (engine->num_pending_onsets == MODAL_ENGINE_MAX_PENDING_ONSETS) break;
+        onset_event_t& pending = engine->pending_onsets[engine->num_pending_onsets++];
+        pending = onsets[e];
+        pending.position += engine->lookahead_samples;
+    }
 
-    // Detect pitch from input (every buffer)
-    float detected_freq = detect_pitch_zcr(engine->pitch_buffer, engine->pitch_buf_size,
-                                          static_cast<float>(engine->sample_rate));
+    // Detected pitch from the tracker
+    float detected_freq = track_pitch(engine);
     engine->detected_pitch_hz = detected_freq;
 
     // Calculate base note from bodySize parameter
@@ -314,51 +401,139 @@ void modal_attractors_engine_process(ModalEffectEngine* engine,
         target_note = static_cast<uint8_t>(blended_note + 0.5f);
     }
 
-    // Trigger note on rising energy (onset detection)
-    if (energyDelta > threshold * excite && energy > 0.002f * excite) {
-        // Send note-off for previous note if one is playing
+    // Turn onsets due in this buffer into notes at their offsets, between
+    // any host events (without lookahead, earlier ones go at offset 0)
+    const uint64_t buffer_end = buffer_start + num_frames;
+    uint32_t num_due = 0;
+    while (num_due < engine->num_pending_onsets &&
+           engine->pending_onsets[num_due].position < buffer_end) {
+        num_due++;
+    }
+
+    for (uint32_t e = 0; e < num_due; ++e) {
+        const onset_event_t& onset = engine->pending_onsets[e];
+        const int32_t offset = (onset.position > buffer_start)
+                             ? static_cast<int32_t>(onset.position - buffer_start) : 0;
+
+        // Send note-off for previous note if one is playing (an onset
+        // retriggers it, a release ends it)
         if (engine->note_is_on) {
             SynthEvent noteOff;
             noteOff.type = EventType::NoteOff;
-            noteOff.sampleOffset = 0;
+            noteOff.sampleOffset = offset;
             noteOff.noteOff.note = engine->current_note;
-            engine->event_queue->push(noteOff);
+            engine->event_queue->insert(noteOff);
+            engine->note_is_on = false;
         }
 
-        // Trigger new note with velocity based on energy and excite
-        float velocity = fminf(energy * 20.0f * (0.5f + excite * 0.5f), 1.0f);
+        if (onset.type != ONSET_EVENT_ONSET) continue;
+
+        // Trigger new note with velocity based on onset level and excite
+        float velocity = fminf(onset.level * 20.0f * (0.5f + excite * 0.5f), 1.0f);
         if (velocity < 0.1f) velocity = 0.1f;
 
         SynthEvent noteOn;
         noteOn.type = EventType::NoteOn;
-        noteOn.sampleOffset = 0;
+        noteOn.sampleOffset = offset;
         noteOn.noteOn.note = target_note;
         noteOn.noteOn.velocity = velocity;
-        noteOn.noteOn.channel = 0;
-        engine->event_queue->push(noteOn);
+        noteOn.noteOn.channel = (engine->onset_routing == MODAL_ONSET_ROUTING_PER_BAND)
+                              ? onset_band(onset.centroid_hz) : 0;
+        engine->event_queue->insert(noteOn);
 
         engine->current_note = target_note;
         engine->note_is_on = true;
     }
 
-    // Auto note-off when energy drops significantly (for cleaner sound)
-    if (engine->note_is_on && engine->smoothed_energy < 0.001f) {
-        SynthEvent noteOff;
-        noteOff.type = EventType::NoteOff;
-        noteOff.sampleOffset = 0;
-        noteOff.noteOff.note = engine->current_note;
-        engine->event_queue->push(noteOff);
-        engine->note_is_on = false;
-    }
+    engine->num_pending_onsets -= num_due;
+    memmove(engine->pending_onsets, engine->pending_onsets + num_due,
+            engine->num_pending_onsets * sizeof(onset_event_t));
 
     // Render modal synthesis (wet signal) using pre-allocated buffers
     engine->synth_engine->render(*engine->event_queue, engine->wetL, engine->wetR, num_frames);
 
-    // Mix dry and wet signals
+    // Mix dry and wet signals (dry through the lookahead delay; reads each
+    // input sample before writing the output, so in-place buffers are fine)
+    const uint32_t delay = engine->lookahead_samples;
+    if (delay == 0) {
+        for (uint32_t i = 0; i < num_frames; ++i) {
+            outL[i] = inL[i] * dryGain + engine->wetL[i] * wetGain;
+            outR[i] = inR[i] * dryGain + engine->wetR[i] * wetGain;
+        }
+        return;
+    }
+
+    uint32_t pos = engine->dry_delay_pos;
     for (uint32_t i = 0; i < num_frames; ++i) {
-        outL[i] = inL[i] * dryGain + engine->wetL[i] * wetGain;
-        outR[i] = inR[i] * dryGain + engine->wetR[i] * wetGain;
+        const float dryL = engine->dry_delay_l[pos];
+        const float dryR = engine->dry_delay_r[pos];
+        engine->dry_delay_l[pos] = inL[i];
+        engine->dry_delay_r[pos] = inR[i];
+        if (++pos == delay) pos = 0;
+
+        outL[i] = dryL * dryGain + engine->wetL[i] * wetGain;
+        outR[i] = dryR * dryGain + engine->wetR[i] * wetGain;
+    }
+    engine->dry_delay_pos = pos;
+}
+
+// ============================================================================
+// Onset handling (effect mode)
+// ============================================================================
+
+void modal_attractors_engine_set_lookahead(ModalEffectEngine* engine, float lookahead_ms) {
+    if (!engine || !engine->initialized) return;
+
+    if (lookahead_ms < 0.0f) lookahead_ms = 0.0f;
+    if (lookahead_ms > MODAL_ENGINE_MAX_LOOKAHEAD_MS) lookahead_ms = MODAL_ENGINE_MAX_LOOKAHEAD_MS;
+
+    engine->lookahead_ms = lookahead_ms;
+    request_lookahead(engine);
+}
+
+uint32_t modal_attractors_engine_get_latency(const ModalEffectEngine* engine) {
+    if (!engine || !engine->initialized) return 0;
+
+    return __atomic_load_n(&engine->requested_lookahead_samples, __ATOMIC_RELAXED);
+}
+
+void modal_attractors_engine_set_onset_routing(ModalEffectEngine* engine,
+                                               modal_onset_routing_t routing) {
+    if (!engine || !engine->initialized) return;
+
+    // Per-band picks the node itself and passes it as the MIDI channel
+    NoteRoutingMode mode = NoteRoutingMode::MidiChannel;
+    if (routing == MODAL_ONSET_ROUTING_ROUND_ROBIN) {
+        mode = NoteRoutingMode::RoundRobin;
+    } else if (routing == MODAL_ONSET_ROUTING_PITCH_ZONES) {
+        mode = NoteRoutingMode::PitchZone;
     }
+
+    engine->onset_routing = routing;
+    engine->synth_engine->setNoteRouting(mode);
+}
+
+// ============================================================================
+// Control rate
+// ============================================================================
+
+void modal_attractors_engine_set_control_rate(ModalEffectEngine* engine, double rate_hz) {
+    if (!engine || !engine->initialized) return;
+
+    engine->synth_engine->setControlRate(rate_hz);
+}
+
+double modal_attractors_engine_get_control_rate(const ModalEffectEngine* engine) {
+    if (!engine || !engine->initialized) return 0.0;
+
+    return engine->synth_engine->getControlRate();
+}
+
+void modal_attractors_engine_set_amplitude_interpolation(ModalEffectEngine* engine,
+                                                         bool enabled) {
+    if (!engine || !engine->initialized) return;
+
+    engine->synth_engine->setAmplitudeInterpolation(enabled);
 }
 
 // ============================================================================
@@ -370,6 +545,11 @@ void modal_attractors_engine_set_parameter(ModalEffectEngine* engine,
                                            float value) {
     if (!engine || !engine->initialized) return;
 
+    if (param_id == MODAL_ENGINE_PARAM_LOOKAHEAD) {
+        modal_attractors_engine_set_lookahead(engine, value);
+        return;
+    }
+
     engine->synth_engine->setParameter(param_id, value);
 }
 
@@ -377,5 +557,9 @@ float modal_attractors_engine_get_parameter(ModalEffectEngine* engine,
                                             uint32_t param_id) {
     if (!engine || !engine->initialized) return 0.0f;
 
+    if (param_id == MODAL_ENGINE_PARAM_LOOKAHEAD) {
+        return engine->lookahead_ms;
+    }
+
     return engine->synth_engine->getParameter(param_id);
 }
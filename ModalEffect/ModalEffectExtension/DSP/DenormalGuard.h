@@ -0,0 +1,108 @@
+/**
+ * @file DenormalGuard.h
+ * @brief Flush-to-zero scope for render entry points and snap-to-zero helpers
+ *
+ * Every decaying state in the engine (mode amplitudes, amplitude smoothers,
+ * biquad histories, envelope followers) approaches zero exponentially once
+ * the input stops, and ends up in the denormal range, where x86 arithmetic
+ * is many times slower. Two layers keep the quiet tail cheap:
+ *
+ * - denormal_guard_enter()/denormal_guard_leave() (or DenormalGuard in C++)
+ *   around each render entry point set flush-to-zero and denormals-are-zero
+ *   (SSE MXCSR FTZ|DAZ, ARM64 FPCR.FZ) and restore the caller's mode after.
+ * - denormal_snap() zeroes a state below DENORMAL_SNAP_LEVEL when it is
+ *   written back, so the states reach exact zero even without the guard
+ *   (another host thread, a build without SSE/ARM64).
+ */
+
+#ifndef DENORMAL_GUARD_H
+#define DENORMAL_GUARD_H
+
+#include <stdint.h>
+#include <math.h>
+
+#if defined(__SSE__) || defined(__x86_64__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define DENORMAL_GUARD_SSE 1
+#elif defined(__aarch64__)
+#define DENORMAL_GUARD_ARM64 1
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// States below this magnitude are snapped to zero (-300 dB)
+#define DENORMAL_SNAP_LEVEL 1e-15f
+
+/**
+ * @brief Saved floating-point control state
+ */
+typedef struct {
+    uint64_t saved;             ///< Caller's MXCSR / FPCR
+} denormal_guard_t;
+
+/**
+ * @brief Enable flush-to-zero for the current thread
+ *
+ * @param guard Receives the caller's mode for denormal_guard_leave()
+ */
+static inline void denormal_guard_enter(denormal_guard_t* guard) {
+#if defined(DENORMAL_GUARD_SSE)
+    guard->saved = _mm_getcsr();
+    _mm_setcsr((unsigned int)guard->saved | 0x8040u);  // FTZ (bit 15) | DAZ (bit 6)
+#elif defined(DENORMAL_GUARD_ARM64)
+    uint64_t fpcr;
+    __asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+    guard->saved = fpcr;
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr | (1ull << 24)));  // FZ
+#else
+    guard->saved = 0;
+#endif
+}
+
+/**
+ * @brief Restore the mode saved by denormal_guard_enter()
+ *
+ * @param guard State filled by denormal_guard_enter()
+ */
+static inline void denormal_guard_leave(const denormal_guard_t* guard) {
+#if defined(DENORMAL_GUARD_SSE)
+    _mm_setcsr((unsigned int)guard->saved);
+#elif defined(DENORMAL_GUARD_ARM64)
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(guard->saved));
+#else
+    (void)guard;
+#endif
+}
+
+/**
+ * @brief Snap a decaying state to zero
+ *
+ * @param x State value
+ * @return x, or 0 if |x| < DENORMAL_SNAP_LEVEL
+ */
+static inline float denormal_snap(float x) {
+    return (fabsf(x) < DENORMAL_SNAP_LEVEL) ? 0.0f : x;
+}
+
+#ifdef __cplusplus
+}
+
+/**
+ * @brief Flush-to-zero for the lifetime of the object (one render call)
+ */
+class DenormalGuard {
+public:
+    DenormalGuard() { denormal_guard_enter(&state_); }
+    ~DenormalGuard() { denormal_guard_leave(&state_); }
+
+    DenormalGuard(const DenormalGuard&) = delete;
+    DenormalGuard& operator=(const DenormalGuard&) = delete;
+
+private:
+    denormal_guard_t state_;
+};
+#endif
+
+#endif // DENORMAL_GUARD_H
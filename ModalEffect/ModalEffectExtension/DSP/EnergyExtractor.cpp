@@ -4,6 +4,7 @@
  */
 
 #include "EnergyExtractor.h"
+#include "DenormalGuard.h"
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
@@ -72,7 +73,7 @@ float energy_extractor_process(energy_extractor_t* extractor, float input) {
         coeff = extractor->release_coeff;
     }
 
-    extractor->envelope = coeff * extractor->envelope + (1.0f - coeff) * rms;
+    extractor->envelope = denormal_snap(coeff * extractor->envelope + (1.0f - coeff) * rms);
 
     return extractor->envelope;
 }
@@ -81,11 +82,36 @@ void energy_extractor_process_buffer(energy_extractor_t* extractor,
                                      const float* input,
                                      float* output,
                                      uint32_t num_samples) {
-    if (!extractor || !input || !output) return;
+    if (!extractor || !extractor->initialized || !input || !output) return;
+
+    // Same recurrence as energy_extractor_process(), state kept in locals
+    float* rms_buffer = extractor->rms_buffer;
+    const uint32_t window_size = extractor->rms_window_size;
+    const float attack_coeff = extractor->attack_coeff;
+    const float release_coeff = extractor->release_coeff;
+    float window_sum = extractor->rms_window_sum;
+    float envelope = extractor->envelope;
+    uint32_t index = extractor->rms_index;
 
     for (uint32_t i = 0; i < num_samples; i++) {
-        output[i] = energy_extractor_process(extractor, input[i]);
+        float input_sq = input[i] * input[i];
+
+        window_sum = window_sum - rms_buffer[index] + input_sq;
+        rms_buffer[index] = input_sq;
+        if (++index == window_size) {
+            index = 0;
+        }
+
+        float rms = sqrtf(window_sum / (float)window_size);
+        float coeff = (rms > envelope) ? attack_coeff : release_coeff;
+        envelope = coeff * envelope + (1.0f - coeff) * rms;
+
+        output[i] = envelope;
     }
+
+    extractor->rms_window_sum = window_sum;
+    extractor->envelope = denormal_snap(envelope);
+    extractor->rms_index = index;
 }
 
 float energy_extractor_get_envelope(const energy_extractor_t* extractor) {
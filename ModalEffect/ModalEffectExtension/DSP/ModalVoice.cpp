@@ -10,12 +10,11 @@
 ModalVoice::ModalVoice(uint8_t voice_id)
     : voice_id_(voice_id)
     , state_(State::Inactive)
+    , dormant_(false)
     , midi_note_(60)
     , velocity_(0.0f)
     , pitch_bend_(0.0f)
     , age_(0)
-    , samples_since_update_(0)
-    , samples_per_update_(0)
     , sample_rate_(48000.0f)
 {
     // Initialize node with resonator personality by default
@@ -29,10 +28,6 @@ ModalVoice::~ModalVoice() {
 void ModalVoice::initialize(float sample_rate) {
     sample_rate_ = sample_rate;
 
-    // Calculate samples per control update
-    // Control rate is 500 Hz (CONTROL_RATE_HZ)
-    samples_per_update_ = static_cast<uint32_t>(sample_rate / CONTROL_RATE_HZ);
-
     // Initialize audio synth
     audio_synth_init(&synth_, &node_, sample_rate);
 
@@ -51,6 +46,7 @@ void ModalVoice::noteOn(uint8_t midi_note, float velocity) {
     midi_note_ = midi_note;
     velocity_ = velocity;
     state_ = State::Attack;
+    dormant_ = false;
     age_ = 0;
 
     // Update frequencies based on new note
@@ -76,6 +72,12 @@ void ModalVoice::noteOn(uint8_t midi_note, float velocity) {
 void ModalVoice::noteOff() {
     if (state_ == State::Inactive) return;
 
+    // Already silent: nothing left to release
+    if (dormant_) {
+        reset();
+        return;
+    }
+
     state_ = State::Release;
 }
 
@@ -85,35 +87,53 @@ void ModalVoice::setPitchBend(float bend_amount, float bend_range) {
 }
 
 void ModalVoice::updateModal() {
-    if (state_ == State::Inactive) return;
+    if (!isAwake()) return;
 
     // Step modal dynamics
     modal_node_step(&node_);
 
+    advanceState();
+}
+
+void ModalVoice::advanceState() {
+    if (!isAwake()) return;
+
     // Update state machine
     updateState();
 
+    // Resonators never leave Attack on their own; stop stepping them once
+    // they have rung out (self-oscillators are never silent)
+    if (state_ != State::Inactive && modal_node_is_silent(&node_)) {
+        dormant_ = true;
+    }
+
     // Increment age
     age_++;
 }
 
+void ModalVoice::setControlTimestep(float dt, uint32_t tick_samples, bool interpolate) {
+    modal_node_set_dt(&node_, dt);
+    audio_synth_set_interpolation(&synth_,
+                                  interpolate ? AUDIO_SYNTH_INTERP_LINEAR
+                                              : AUDIO_SYNTH_INTERP_SMOOTH,
+                                  tick_samples);
+}
+
 void ModalVoice::renderAudio(float* outL, float* outR, uint32_t num_frames) {
-    if (state_ == State::Inactive) {
+    // Mono source, duplicated to L/R
+    renderAudioMono(outL, num_frames);
+    memcpy(outR, outL, num_frames * sizeof(float));
+}
+
+void ModalVoice::renderAudioMono(float* out, uint32_t num_frames) {
+    if (!isAwake()) {
         // Silent voice - write zeros
-        memset(outL, 0, num_frames * sizeof(float));
-        memset(outR, 0, num_frames * sizeof(float));
+        memset(out, 0, num_frames * sizeof(float));
         return;
     }
 
-    // Update modal state at control rate (500 Hz)
-    samples_since_update_ += num_frames;
-    while (samples_since_update_ >= samples_per_update_) {
-        updateModal();
-        samples_since_update_ -= samples_per_update_;
-    }
-
-    // Render audio from modal state
-    audio_synth_render(&synth_, outL, outR, num_frames);
+    // Render audio from modal state (stepped by the owner's control scheduler)
+    audio_synth_render_mono(&synth_, out, num_frames);
 }
 
 void ModalVoice::applyCoupling(const float coupling_inputs[MAX_MODES]) {
@@ -124,7 +144,11 @@ void ModalVoice::applyCoupling(const float coupling_inputs[MAX_MODES]) {
 
         // Add coupling as excitation
         float coupling_strength = node_.coupling_strength * coupling_inputs[k];
-        node_.modes[k].a += coupling_strength * CONTROL_DT;
+        node_.modes[k].a += coupling_strength * node_.dt;
+    }
+
+    if (dormant_ && !modal_node_is_silent(&node_)) {
+        dormant_ = false;
     }
 }
 
@@ -135,7 +159,11 @@ void ModalVoice::applyCouplingMode0(modal_complex_t coupling0) {
 
     // Direct application - coupling strength already applied in TopologyEngine
     // node_.coupling_strength is kept at 1.0 for predictable behavior
-    node_.modes[0].a += coupling0 * CONTROL_DT;
+    node_.modes[0].a += coupling0 * node_.dt;
+
+    if (dormant_ && !modal_node_is_silent(&node_)) {
+        dormant_ = false;
+    }
 }
 
 float ModalVoice::getAmplitude() const {
@@ -157,18 +185,18 @@ void ModalVoice::setMode(uint8_t mode_idx, float freq_hz, float damping, float w
 }
 
 void ModalVoice::setPersonality(node_personality_t personality) {
-    node_.personality = personality;
+    modal_node_set_personality(&node_, personality);
 }
 
 void ModalVoice::setGlobalDamping(float damping) {
-    node_.global_damping = damping;
+    modal_node_set_global_damping(&node_, damping);
 }
 
 void ModalVoice::reset() {
     modal_node_reset(&node_);
     state_ = State::Inactive;
+    dormant_ = false;
     age_ = 0;
-    samples_since_update_ = 0;
 }
 
 void ModalVoice::updateFrequencies() {
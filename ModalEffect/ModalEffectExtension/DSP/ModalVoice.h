@@ -77,6 +77,27 @@ public:
      */
     void updateModal();
 
+    /**
+     * @brief Advance voice bookkeeping after an external modal step
+     *
+     * Use instead of updateModal() when the node has already been integrated
+     * by a modal_bank_t. Runs the state machine, ages the voice and puts it
+     * to sleep once it has decayed to silence.
+     */
+    void advanceState();
+
+    /**
+     * @brief Set the modal integration timestep
+     * @param dt Control tick length in seconds
+     * @param tick_samples Control tick length in samples
+     * @param interpolate Ramp amplitudes linearly across each tick
+     *
+     * The voice does not step itself while rendering; its owner calls
+     * updateModal() (or steps it through a modal_bank_t) once per control
+     * tick and sets dt to match the tick length.
+     */
+    void setControlTimestep(float dt, uint32_t tick_samples, bool interpolate);
+
     /**
      * @brief Render audio block
      * @param outL Left channel output
@@ -85,9 +106,18 @@ public:
      */
     void renderAudio(float* outL, float* outR, uint32_t num_frames);
 
+    /**
+     * @brief Render audio block (mono)
+     * @param out Output buffer
+     * @param num_frames Number of frames to render
+     */
+    void renderAudioMono(float* out, uint32_t num_frames);
+
     /**
      * @brief Apply coupling input from other voices
      * @param coupling_inputs Array of 4 coupling inputs (one per mode)
+     *
+     * Wakes a dormant voice once the input lifts it above the silence level.
      */
     void applyCoupling(const float coupling_inputs[MAX_MODES]);
 
@@ -114,6 +144,23 @@ public:
         return state_ != State::Inactive;
     }
 
+    /**
+     * @brief Check if voice is asleep
+     * @return True if the voice holds a note but has decayed to silence
+     *
+     * A dormant voice is neither stepped nor rendered. Excitation (noteOn)
+     * or coupling input that lifts it above the silence level wakes it.
+     */
+    bool isDormant() const { return dormant_; }
+
+    /**
+     * @brief Check if voice needs stepping and rendering
+     * @return True if voice is active and not dormant
+     */
+    bool isAwake() const {
+        return state_ != State::Inactive && !dormant_;
+    }
+
     /**
      * @brief Get MIDI note number
      * @return Current MIDI note
@@ -185,6 +232,14 @@ public:
         return &node_;
     }
 
+    /**
+     * @brief Get audio synthesis state
+     * @return Pointer to internal audio_synth_t
+     */
+    audio_synth_t* getSynth() {
+        return &synth_;
+    }
+
     /**
      * @brief Reset voice state
      */
@@ -196,13 +251,12 @@ private:
     audio_synth_t synth_;           ///< Audio synthesis state
 
     State state_;                   ///< Voice state
+    bool dormant_;                  ///< Decayed below the silence level (skipped)
     uint8_t midi_note_;             ///< Current MIDI note
     float velocity_;                ///< Note velocity (0.0-1.0)
     float pitch_bend_;              ///< Pitch bend amount (-1.0 to +1.0)
 
     uint32_t age_;                  ///< Voice age counter
-    uint32_t samples_since_update_; ///< Sample counter for control rate
-    uint32_t samples_per_update_;   ///< Samples between control updates
 
     float sample_rate_;             ///< Current sample rate
 
@@ -5,23 +5,28 @@
 
 #include "NodeManager.h"
 #include <cstring>
+#include <cmath>
 #include <algorithm>
 
 NodeManager::NodeManager()
     : routing_mode_(NoteRoutingMode::MidiChannel)
     , multi_excite_mode_(MultiExciteMode::Accumulate)
     , active_node_count_(5)        // Default: all 5 nodes active
+    , next_node_(0)
+    , zone_low_note_(36)           // Default: C2-C6, the effect's body size range
+    , zone_high_note_(96)
     , pitch_bend_(0.0f)
     , sample_rate_(48000.0f)
     , initialized_(false)
-    , temp_buffer_L_(nullptr)
-    , temp_buffer_R_(nullptr)
+    , stereo_pan_enabled_(false)
+    , temp_buffer_(nullptr)
     , max_buffer_size_(0)
 {
     // Create exactly 5 nodes
     for (uint8_t i = 0; i < NUM_NETWORK_NODES; i++) {
         nodes_[i] = new ModalVoice(i);
         node_character_ids_[i] = i;  // Default: each node gets its own character
+        setNodePan(i, 0.0f);         // Default: centered
     }
 
     // Initialize note mapping
@@ -38,14 +43,10 @@ NodeManager::~NodeManager() {
         }
     }
 
-    // Free temp buffers
-    if (temp_buffer_L_) {
-        delete[] temp_buffer_L_;
-        temp_buffer_L_ = nullptr;
-    }
-    if (temp_buffer_R_) {
-        delete[] temp_buffer_R_;
-        temp_buffer_R_ = nullptr;
+    // Free temp buffer
+    if (temp_buffer_) {
+        delete[] temp_buffer_;
+        temp_buffer_ = nullptr;
     }
 }
 
@@ -60,10 +61,17 @@ void NodeManager::initialize(float sample_rate) {
         setNodeCharacter(i, node_character_ids_[i]);
     }
 
-    // Allocate temp buffers (real-time safe rendering)
+    // Bind node states to the SoA bank
+    modal_bank_init(&bank_, NUM_NETWORK_NODES);
+    for (uint8_t i = 0; i < NUM_NETWORK_NODES; i++) {
+        modal_bank_bind_node(&bank_, i, nodes_[i]->getModalNode());
+    }
+
+    // Allocate temp buffer (real-time safe rendering)
     max_buffer_size_ = 2048;  // Covers most typical buffer sizes
-    temp_buffer_L_ = new float[max_buffer_size_];
-    temp_buffer_R_ = new float[max_buffer_size_];
+    if (!temp_buffer_) {
+        temp_buffer_ = new float[max_buffer_size_];
+    }
 
     initialized_ = true;
 }
@@ -182,6 +190,14 @@ void NodeManager::setNodeCount(uint8_t count) {
     active_node_count_ = count;
 }
 
+void NodeManager::setControlTimestep(float dt, uint32_t tick_samples, bool interpolate) {
+    for (uint8_t i = 0; i < NUM_NETWORK_NODES; i++) {
+        if (nodes_[i]) {
+            nodes_[i]->setControlTimestep(dt, tick_samples, interpolate);
+        }
+    }
+}
+
 void NodeManager::setGlobalDamping(float damping) {
     if (!initialized_) return;
 
@@ -193,6 +209,27 @@ void NodeManager::setGlobalDamping(float damping) {
     }
 }
 
+// ============================================================================
+// Stereo Placement
+// ============================================================================
+
+void NodeManager::setNodePan(uint8_t node_idx, float pan) {
+    if (node_idx >= NUM_NETWORK_NODES) return;
+
+    pan = std::clamp(pan, -1.0f, 1.0f);
+    node_pan_[node_idx] = pan;
+
+    // Equal-power law, scaled by √2 so center = unity in both channels
+    float theta = (pan + 1.0f) * 0.25f * static_cast<float>(M_PI);
+    pan_gain_L_[node_idx] = std::cos(theta) * static_cast<float>(M_SQRT2);
+    pan_gain_R_[node_idx] = std::sin(theta) * static_cast<float>(M_SQRT2);
+}
+
+float NodeManager::getNodePan(uint8_t node_idx) const {
+    if (node_idx >= NUM_NETWORK_NODES) return 0.0f;
+    return node_pan_[node_idx];
+}
+
 // ============================================================================
 // Note Routing
 // ============================================================================
@@ -217,12 +254,37 @@ uint8_t NodeManager::routeNoteToNodes(uint8_t midi_note, uint8_t midi_channel, u
                 return active_node_count_;
             }
 
+        case NoteRoutingMode::RoundRobin:
+            // Each note on the next node, so successive notes ring side by side
+            {
+                uint8_t node_idx = next_node_ % active_node_count_;
+                next_node_ = (node_idx + 1) % active_node_count_;
+                target_nodes[0] = node_idx;
+                return 1;
+            }
+
+        case NoteRoutingMode::PitchZone:
+            // Equal-width zones across the zone range
+            {
+                int span = zone_high_note_ - zone_low_note_ + 1;
+                int zone = (static_cast<int>(midi_note) - zone_low_note_) * active_node_count_ / span;
+                target_nodes[0] = static_cast<uint8_t>(std::clamp(zone, 0, active_node_count_ - 1));
+                return 1;
+            }
+
         default:
             target_nodes[0] = 0;
             return 1;
     }
 }
 
+void NodeManager::setPitchZoneRange(uint8_t low_note, uint8_t high_note) {
+    if (low_note > 127 || high_note > 127 || low_note > high_note) return;
+
+    zone_low_note_ = low_note;
+    zone_high_note_ = high_note;
+}
+
 // ============================================================================
 // Note Handling
 // ============================================================================
@@ -342,10 +404,24 @@ void NodeManager::releaseNode(uint8_t node_idx) {
 void NodeManager::updateNodes() {
     if (!initialized_) return;
 
-    // Update only active nodes at control rate
+    // Select only awake nodes within the active node count (dormant nodes
+    // have rung out and stay frozen until excitation or coupling wakes them)
+    uint32_t node_mask = 0;
     for (uint8_t i = 0; i < active_node_count_; i++) {
-        if (nodes_[i]->isActive()) {
-            nodes_[i]->updateModal();
+        if (nodes_[i]->isAwake()) {
+            node_mask |= 1u << i;
+        }
+    }
+
+    if (node_mask == 0) return;
+
+    // Integrate all selected nodes in one SoA pass
+    modal_bank_step(&bank_, node_mask);
+
+    // Per-voice state machine (release detection, age)
+    for (uint8_t i = 0; i < active_node_count_; i++) {
+        if ((node_mask >> i) & 1u) {
+            nodes_[i]->advanceState();
         }
     }
 }
@@ -358,33 +434,81 @@ void NodeManager::renderAudio(float* outL, float* outR, uint32_t num_frames) {
         return;
     }
 
+    // Nodes render mono. Without panning they mix into L, which is copied
+    // to R at the end; with panning each node is weighted into L and R.
+    // A single (mono) output buffer never pans.
+    const bool mono_out = (outR == outL);
+    const bool stereo = stereo_pan_enabled_ && !mono_out;
+
     // Clear output buffers
     memset(outL, 0, num_frames * sizeof(float));
-    memset(outR, 0, num_frames * sizeof(float));
+    if (stereo) {
+        memset(outR, 0, num_frames * sizeof(float));
+    }
 
     // Check buffer size
     if (num_frames > max_buffer_size_) {
         // Shouldn't happen, but handle gracefully
+        if (!stereo && !mono_out) {
+            memset(outR, 0, num_frames * sizeof(float));
+        }
         num_frames = max_buffer_size_;
     }
 
+    // All-sine nodes render together straight into the output;
+    // anything else goes through the temp buffer
+    audio_synth_t* batch[NUM_NETWORK_NODES];
+    float batch_gain_L[NUM_NETWORK_NODES];
+    float batch_gain_R[NUM_NETWORK_NODES];
+    uint32_t batch_count = 0;
+
     // OPTIMIZATION: Only render active node count
-    // Skip nodes beyond active_node_count_ and inactive nodes
+    // Skip nodes beyond active_node_count_, inactive and dormant nodes
     for (uint8_t i = 0; i < active_node_count_; i++) {
-        // Skip inactive nodes (major performance win!)
-        if (!nodes_[i]->isActive()) {
+        // Skip silent nodes (major performance win!)
+        if (!nodes_[i]->isAwake()) {
+            continue;
+        }
+
+        audio_synth_t* synth = nodes_[i]->getSynth();
+        if (audio_synth_can_batch(synth)) {
+            batch[batch_count] = synth;
+            batch_gain_L[batch_count] = pan_gain_L_[i];
+            batch_gain_R[batch_count] = pan_gain_R_[i];
+            batch_count++;
             continue;
         }
 
-        // Render active node to temp buffer
-        nodes_[i]->renderAudio(temp_buffer_L_, temp_buffer_R_, num_frames);
+        // Render node to temp buffer and mix into output
+        audio_synth_render_mono(synth, temp_buffer_, num_frames);
+
+        if (stereo) {
+            const float gain_L = pan_gain_L_[i];
+            const float gain_R = pan_gain_R_[i];
+            for (uint32_t j = 0; j < num_frames; j++) {
+                outL[j] += gain_L * temp_buffer_[j];
+                outR[j] += gain_R * temp_buffer_[j];
+            }
+        } else {
+            for (uint32_t j = 0; j < num_frames; j++) {
+                outL[j] += temp_buffer_[j];
+            }
+        }
+    }
 
-        // Mix into output
-        for (uint32_t j = 0; j < num_frames; j++) {
-            outL[j] += temp_buffer_L_[j];
-            outR[j] += temp_buffer_R_[j];
+    if (batch_count > 0) {
+        if (stereo) {
+            audio_synth_render_batch(batch, batch_gain_L, batch_gain_R, batch_count,
+                                     outL, outR, num_frames);
+        } else {
+            audio_synth_render_batch(batch, nullptr, nullptr, batch_count,
+                                     outL, nullptr, num_frames);
         }
     }
+
+    if (!stereo && !mono_out) {
+        memcpy(outR, outL, num_frames * sizeof(float));
+    }
 }
 
 // ============================================================================
@@ -405,3 +529,8 @@ bool NodeManager::isNodeActive(uint8_t node_idx) const {
     if (node_idx >= NUM_NETWORK_NODES) return false;
     return nodes_[node_idx]->isActive();
 }
+
+bool NodeManager::isNodeDormant(uint8_t node_idx) const {
+    if (node_idx >= NUM_NETWORK_NODES) return false;
+    return nodes_[node_idx]->isDormant();
+}
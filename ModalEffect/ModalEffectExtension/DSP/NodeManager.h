@@ -15,6 +15,7 @@
 
 #include "ModalVoice.h"
 #include "NodeCharacter.h"
+#include "modal_bank.h"
 #include <cstdint>
 
 /**
@@ -28,6 +29,8 @@
 enum class NoteRoutingMode : uint8_t {
     MidiChannel = 0,   ///< Route by MIDI channel (Ch 1→Node 0, Ch 2→Node 1, etc.)
     AllNodes = 1,      ///< All nodes receive every note
+    RoundRobin = 2,    ///< Successive notes cycle through the active nodes
+    PitchZone = 3,     ///< Note range split into one zone per active node (low → Node 0)
 };
 
 /**
@@ -125,6 +128,15 @@ public:
         return routing_mode_;
     }
 
+    /**
+     * @brief Set the note range split by PitchZone routing
+     * @param low_note Lowest note of the first zone
+     * @param high_note Highest note of the last zone
+     *
+     * Notes outside the range go to the first or last zone.
+     */
+    void setPitchZoneRange(uint8_t low_note, uint8_t high_note);
+
     /**
      * @brief Set multi-excitation mode
      * @param mode Excitation behavior
@@ -157,6 +169,14 @@ public:
         return active_node_count_;
     }
 
+    /**
+     * @brief Set modal integration timestep for all nodes
+     * @param dt Control tick length in seconds
+     * @param tick_samples Control tick length in samples
+     * @param interpolate Ramp amplitudes linearly across each tick
+     */
+    void setControlTimestep(float dt, uint32_t tick_samples, bool interpolate);
+
     /**
      * @brief Set global damping for all nodes
      * @param damping Global damping coefficient (>= 0.0)
@@ -167,6 +187,43 @@ public:
      */
     void setGlobalDamping(float damping);
 
+    // ========================================================================
+    // Stereo Placement
+    // ========================================================================
+
+    /**
+     * @brief Set stereo pan for a node
+     * @param node_idx Node index (0-4)
+     * @param pan Pan position (-1.0 = left, 0.0 = center, +1.0 = right)
+     *
+     * Equal-power pan applied at the final mix, normalized so a centered
+     * node has unity gain in both channels. Only used while stereo panning
+     * is enabled.
+     */
+    void setNodePan(uint8_t node_idx, float pan);
+
+    /**
+     * @brief Get stereo pan for a node
+     * @param node_idx Node index (0-4)
+     * @return Pan position, or 0.0 if invalid node
+     */
+    float getNodePan(uint8_t node_idx) const;
+
+    /**
+     * @brief Enable/disable per-node stereo panning
+     * @param enabled False renders one mono mix copied to both channels
+     */
+    void setStereoPanEnabled(bool enabled) {
+        stereo_pan_enabled_ = enabled;
+    }
+
+    /**
+     * @brief Check if per-node stereo panning is enabled
+     */
+    bool isStereoPanEnabled() const {
+        return stereo_pan_enabled_;
+    }
+
     // ========================================================================
     // Note Handling
     // ========================================================================
@@ -233,7 +290,11 @@ public:
     /**
      * @brief Update all nodes at control rate
      *
-     * Should be called at control rate (500 Hz typically)
+     * Called exactly once per control tick by the owner's scheduler
+     * (see setControlTimestep()). All awake nodes are integrated
+     * together in one modal_bank_t pass; rendering never steps nodes.
+     * Nodes that have decayed below -120 dB go dormant and are skipped
+     * by stepping, rendering and as coupling sources until woken.
      */
     void updateNodes();
 
@@ -262,6 +323,13 @@ public:
      */
     bool isNodeActive(uint8_t node_idx) const;
 
+    /**
+     * @brief Check if node is dormant
+     * @param node_idx Node index (0-4)
+     * @return True if node holds a note but has decayed to silence
+     */
+    bool isNodeDormant(uint8_t node_idx) const;
+
 private:
     // Network nodes (fixed 5)
     ModalVoice* nodes_[NUM_NETWORK_NODES];  ///< Fixed array of 5 nodes
@@ -274,6 +342,9 @@ private:
     NoteRoutingMode routing_mode_;          ///< Current routing strategy
     MultiExciteMode multi_excite_mode_;     ///< Current excitation behavior
     uint8_t active_node_count_;             ///< Number of active nodes (1-5)
+    uint8_t next_node_;                     ///< Next RoundRobin target
+    uint8_t zone_low_note_;                 ///< PitchZone range (inclusive)
+    uint8_t zone_high_note_;
 
     // Note tracking (for note-off routing)
     uint8_t note_to_node_[128];             ///< MIDI note → node mapping (-1 = none)
@@ -284,9 +355,17 @@ private:
     float sample_rate_;                     ///< Current sample rate
     bool initialized_;                      ///< Initialization flag
 
-    // Pre-allocated temp buffers (real-time safe)
-    float* temp_buffer_L_;                  ///< Temp buffer for rendering (L)
-    float* temp_buffer_R_;                  ///< Temp buffer for rendering (R)
+    // SoA modal bank (steps all nodes in one pass)
+    modal_bank_t bank_;                     ///< Bound to each node's modal_node_t
+
+    // Stereo placement
+    float node_pan_[NUM_NETWORK_NODES];     ///< Pan per node [-1, 1]
+    float pan_gain_L_[NUM_NETWORK_NODES];   ///< Left gain per node (from pan)
+    float pan_gain_R_[NUM_NETWORK_NODES];   ///< Right gain per node (from pan)
+    bool stereo_pan_enabled_;               ///< Apply pan at final mix
+
+    // Pre-allocated temp buffer (real-time safe)
+    float* temp_buffer_;                    ///< Temp buffer for rendering (mono)
     uint32_t max_buffer_size_;              ///< Max buffer size allocated
 
     /**
@@ -0,0 +1,218 @@
+/**
+ * @file OnsetDetector.cpp
+ * @brief Streaming onset detection implementation
+ */
+
+#include "OnsetDetector.h"
+#include "DenormalGuard.h"
+#include <math.h>
+#include <string.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define LEVEL_SMOOTHING_MS 200.0f    // Slow level average time constant
+#define ONSET_HOLDOFF_MS 30.0f       // Minimum time between onsets (> two windows)
+#define RISE_FLOOR 0.005f            // Rise threshold on silence (-46 dB)
+#define RISE_RATIO 0.5f              // Rise threshold per unit of average level
+#define LEVEL_FLOOR 0.002f           // Minimum hop level for an onset
+#define RELEASE_LEVEL 0.001f         // Average level that ends an onset (-60 dB)
+
+// Ring slot of the n-th newest-but-(2W-1-n) hop sum (n = 0 is the oldest)
+static uint32_t hop_slot(const onset_detector_t* detector, uint32_t n) {
+    return (detector->hop_index + n) % (2 * ONSET_WINDOW_HOPS);
+}
+
+// Offset back from the newest sample to the onset in the current window:
+// the hop with the largest level jump, first sample reaching half its peak
+static uint32_t locate_onset(const onset_detector_t* detector, float* loudest) {
+    const uint32_t hop = detector->hop_size;
+    const float inv_hop = 1.0f / (float)hop;
+
+    uint32_t best = ONSET_WINDOW_HOPS;
+    float best_jump = -1.0f;
+    float before = sqrtf(detector->hop_sums[hop_slot(detector, ONSET_WINDOW_HOPS - 1)] * inv_hop);
+    *loudest = 0.0f;
+    for (uint32_t n = ONSET_WINDOW_HOPS; n < 2 * ONSET_WINDOW_HOPS; n++) {
+        float level = sqrtf(detector->hop_sums[hop_slot(detector, n)] * inv_hop);
+        if (level - before > best_jump) {
+            best_jump = level - before;
+            best = n;
+        }
+        *loudest = fmaxf(*loudest, level);
+        before = level;
+    }
+
+    // The magnitude ring is hop aligned and its next slot is the oldest sample
+    const float* magnitude = detector->magnitude +
+        (detector->magnitude_index + (best - ONSET_WINDOW_HOPS) * hop) % (ONSET_WINDOW_HOPS * hop);
+    float peak = 0.0f;
+    for (uint32_t k = 0; k < hop; k++) {
+        peak = fmaxf(peak, magnitude[k]);
+    }
+    uint32_t first = 0;
+    while (first < hop - 1 && magnitude[first] < peak * 0.5f) {
+        first++;
+    }
+
+    return (2 * ONSET_WINDOW_HOPS - 1 - best) * hop + (hop - 1 - first);
+}
+
+// Frequency of the sine with the window's difference-to-energy ratio
+static float window_centroid(const onset_detector_t* detector, float energy) {
+    if (energy <= 0.0f) return 0.0f;
+
+    float diff = 0.0f;
+    for (uint32_t n = 0; n < ONSET_WINDOW_HOPS; n++) {
+        diff += detector->hop_diff_sums[n];
+    }
+
+    float cos_omega = fmaxf(-1.0f, fminf(1.0f, 1.0f - 0.5f * diff / energy));
+    return acosf(cos_omega) * detector->sample_rate / (2.0f * (float)M_PI);
+}
+
+// Evaluate the windows after a complete hop ending at input offset 'end'
+static uint32_t finish_hop(onset_detector_t* detector,
+                           uint32_t end,
+                           onset_event_t* events,
+                           uint32_t num_events,
+                           uint32_t max_events) {
+    detector->hop_sums[detector->hop_index] = detector->hop_sum;
+    detector->hop_diff_sums[detector->hop_index % ONSET_WINDOW_HOPS] = detector->hop_diff_sum;
+    detector->hop_index = (detector->hop_index + 1) % (2 * ONSET_WINDOW_HOPS);
+    detector->hop_fill = 0;
+    detector->hop_sum = 0.0f;
+    detector->hop_diff_sum = 0.0f;
+
+    // Level of the last window and of the one before it
+    float previous = 0.0f;
+    float current = 0.0f;
+    for (uint32_t n = 0; n < ONSET_WINDOW_HOPS; n++) {
+        previous += detector->hop_sums[hop_slot(detector, n)];
+        current += detector->hop_sums[hop_slot(detector, n + ONSET_WINDOW_HOPS)];
+    }
+    const float window = (float)(ONSET_WINDOW_HOPS * detector->hop_size);
+    const float level = sqrtf(current / window);
+    const float delta = level - sqrtf(previous / window);
+
+    detector->smoothed_level = denormal_snap(detector->smoothed_level * detector->smoothing_coeff +
+                                             level * (1.0f - detector->smoothing_coeff));
+
+    // Rise against a threshold that follows the level
+    const float threshold = RISE_FLOOR + detector->smoothed_level * RISE_RATIO;
+
+    if (detector->holdoff > 0) {
+        detector->holdoff--;
+    } else if (delta > threshold * detector->threshold &&
+               level > LEVEL_FLOOR * detector->threshold) {
+        // Samples of an onset in the previous buffer are clamped to offset 0
+        float loudest = 0.0f;
+        const uint32_t back = locate_onset(detector, &loudest);
+        const uint64_t position = detector->position + end;
+        if (num_events < max_events) {
+            events[num_events].type = ONSET_EVENT_ONSET;
+            events[num_events].offset = (end > back) ? end - back : 0;
+            events[num_events].position = (position > back) ? position - back : 0;
+            events[num_events].level = loudest;
+            events[num_events].centroid_hz = window_centroid(detector, current);
+            num_events++;
+        }
+
+        detector->holdoff = detector->holdoff_hops;
+        detector->active = true;
+    }
+
+    // Release once the window and the slow average are both quiet (the
+    // average alone still lags behind the first onset)
+    if (detector->active && level < RELEASE_LEVEL &&
+        detector->smoothed_level < RELEASE_LEVEL) {
+        if (num_events < max_events) {
+            events[num_events].type = ONSET_EVENT_RELEASE;
+            events[num_events].offset = end;
+            events[num_events].position = detector->position + end;
+            events[num_events].level = level;
+            events[num_events].centroid_hz = 0.0f;
+            num_events++;
+        }
+        detector->active = false;
+    }
+
+    return num_events;
+}
+
+void onset_detector_init(onset_detector_t* detector, float sample_rate, uint32_t hop_size) {
+    if (!detector) return;
+
+    memset(detector, 0, sizeof(*detector));
+    detector->sample_rate = sample_rate;
+
+    if (hop_size < 1) hop_size = 1;
+    if (hop_size > ONSET_MAX_HOP) hop_size = ONSET_MAX_HOP;
+    detector->hop_size = hop_size;
+
+    // Time constants are per hop, so they do not depend on the host buffer
+    float hop_rate = sample_rate / (float)hop_size;
+    detector->smoothing_coeff = expf(-1000.0f / (LEVEL_SMOOTHING_MS * hop_rate));
+    detector->holdoff_hops = (uint32_t)(ONSET_HOLDOFF_MS * 0.001f * hop_rate + 0.5f);
+
+    detector->threshold = 0.5f;
+}
+
+uint32_t onset_detector_process(onset_detector_t* detector,
+                                const float* input,
+                                uint32_t num_samples,
+                                onset_event_t* events,
+                                uint32_t max_events) {
+    if (!detector || !input || !events) return 0;
+
+    const uint32_t ring_size = ONSET_WINDOW_HOPS * detector->hop_size;
+    uint32_t num_events = 0;
+    for (uint32_t i = 0; i < num_samples; i++) {
+        const float x = input[i];
+        const float diff = x - detector->last_input;
+        detector->last_input = x;
+
+        detector->magnitude[detector->magnitude_index] = fabsf(x);
+        if (++detector->magnitude_index == ring_size) {
+            detector->magnitude_index = 0;
+        }
+        detector->hop_sum += x * x;
+        detector->hop_diff_sum += diff * diff;
+
+        if (++detector->hop_fill == detector->hop_size) {
+            num_events = finish_hop(detector, i, events, num_events, max_events);
+        }
+    }
+
+    detector->position += num_samples;
+    return num_events;
+}
+
+void onset_detector_set_threshold(onset_detector_t* detector, float threshold) {
+    if (!detector) return;
+    detector->threshold = fmaxf(0.0f, fminf(1.0f, threshold));
+}
+
+bool onset_detector_is_active(const onset_detector_t* detector) {
+    if (!detector) return false;
+    return detector->active;
+}
+
+void onset_detector_reset(onset_detector_t* detector) {
+    if (!detector) return;
+
+    detector->position = 0;
+    detector->hop_fill = 0;
+    detector->hop_sum = 0.0f;
+    detector->hop_diff_sum = 0.0f;
+    memset(detector->hop_sums, 0, sizeof(detector->hop_sums));
+    memset(detector->hop_diff_sums, 0, sizeof(detector->hop_diff_sums));
+    detector->last_input = 0.0f;
+    detector->hop_index = 0;
+    memset(detector->magnitude, 0, sizeof(detector->magnitude));
+    detector->magnitude_index = 0;
+    detector->smoothed_level = 0.0f;
+    detector->holdoff = 0;
+    detector->active = false;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file OnsetDetector.h
+ * @brief Streaming onset detection with sample offsets
+ *
+ * Envelope-derivative onset detector for the MIDI-less effect path. The
+ * input is cut into short hops (default 64 samples) independent of the
+ * host buffer. After every hop the RMS level of the last
+ * ONSET_WINDOW_HOPS hops is compared with that of the window before it
+ * (a window spans a low note's period, so waveform ripple does not read
+ * as a rise), and a rise above an adaptive threshold (relative to a slow
+ * level average) is an onset.
+ *
+ * The onset is then placed in the window's hop with the largest level
+ * jump, on the first sample reaching half that hop's peak, so events land
+ * at their real sample offset in the current buffer instead of its start,
+ * whatever the buffer size.
+ *
+ * Each onset also carries a brightness estimate for routing: the window's
+ * first-difference energy over its energy, D/E = 2·(1 - cos ω) for a sine,
+ * read back as the frequency of an equivalent sine (a spectral centroid
+ * proxy that costs one multiply-add per sample).
+ *
+ * A release event follows once the window level and the slow level
+ * average have both fallen below the release level after an onset.
+ */
+
+#ifndef ONSET_DETECTOR_H
+#define ONSET_DETECTOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Longest hop (samples)
+#define ONSET_MAX_HOP 256
+
+// Hops per level window
+#define ONSET_WINDOW_HOPS 8
+
+// Event capacity a caller should provide per process call
+#define ONSET_MAX_EVENTS 32
+
+/**
+ * @brief Detected event types
+ */
+typedef enum {
+    ONSET_EVENT_ONSET = 0,      ///< Transient (level rise)
+    ONSET_EVENT_RELEASE         ///< Level decayed after an onset
+} onset_event_type_t;
+
+/**
+ * @brief Detected event
+ */
+typedef struct onset_event {
+    onset_event_type_t type;    ///< Event type
+    uint32_t offset;            ///< Sample offset in the processed buffer
+    uint64_t position;          ///< Samples processed since reset before the event
+    float level;                ///< RMS level of the loudest hop in the window
+    float centroid_hz;          ///< Brightness of the window (Hz, onsets only)
+} onset_event_t;
+
+/**
+ * @brief Onset detector state
+ */
+typedef struct onset_detector {
+    float sample_rate;          ///< Sample rate in Hz
+    uint64_t position;          ///< Samples processed since reset
+    uint32_t hop_size;          ///< Hop length in samples
+    uint32_t hop_fill;          ///< Samples in the current hop
+    float hop_sum;              ///< Sum of squares in the current hop
+    float hop_diff_sum;         ///< Sum of squared first differences in the current hop
+    float hop_diff_sums[ONSET_WINDOW_HOPS]; ///< Ring: difference sums of the last window
+    float last_input;           ///< Previous input sample
+    float hop_sums[2 * ONSET_WINDOW_HOPS]; ///< Ring: sums of squares of the last two windows
+    uint32_t hop_index;         ///< Next hop_sums slot
+    float magnitude[ONSET_WINDOW_HOPS * ONSET_MAX_HOP]; ///< Ring: magnitudes of the last window
+    uint32_t magnitude_index;   ///< Next magnitude slot
+    float smoothed_level;       ///< Slow average of the window level
+    float smoothing_coeff;      ///< Level smoothing coefficient (per hop)
+    float threshold;            ///< Threshold scale [0, 1] (higher = fewer onsets)
+    uint32_t holdoff_hops;      ///< Minimum hops between onsets
+    uint32_t holdoff;           ///< Hops until the next onset can fire
+    bool active;                ///< Onset seen, release pending
+} onset_detector_t;
+
+/**
+ * @brief Initialize onset detector
+ *
+ * @param detector Pointer to detector structure
+ * @param sample_rate Sample rate in Hz
+ * @param hop_size Hop length in samples (default: 64, at most ONSET_MAX_HOP)
+ */
+void onset_detector_init(onset_detector_t* detector, float sample_rate, uint32_t hop_size);
+
+/**
+ * @brief Process a buffer of samples
+ *
+ * Events are written in offset order; events beyond max_events are dropped.
+ * An onset found in a hop that began in the previous buffer is reported
+ * at offset 0 at the earliest; its position is not clamped, so a caller
+ * that delays its output (lookahead) can still place it exactly.
+ *
+ * @param detector Pointer to detector structure
+ * @param input Input buffer
+ * @param num_samples Number of samples
+ * @param events Output events
+ * @param max_events Capacity of events
+ * @return Number of events written
+ */
+uint32_t onset_detector_process(onset_detector_t* detector,
+                                const float* input,
+                                uint32_t num_samples,
+                                onset_event_t* events,
+                                uint32_t max_events);
+
+/**
+ * @brief Set detection threshold
+ *
+ * Scales the rise and level thresholds: 0 fires on any level rise, 1
+ * needs the level to jump by half its running average plus -46 dB.
+ *
+ * @param detector Pointer to detector structure
+ * @param threshold Threshold scale [0, 1]
+ */
+void onset_detector_set_threshold(onset_detector_t* detector, float threshold);
+
+/**
+ * @brief Check if an onset is awaiting its release
+ *
+ * @param detector Pointer to detector structure
+ * @return True between an onset and the following release
+ */
+bool onset_detector_is_active(const onset_detector_t* detector);
+
+/**
+ * @brief Reset detector state
+ *
+ * @param detector Pointer to detector structure
+ */
+void onset_detector_reset(onset_detector_t* detector);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ONSET_DETECTOR_H
@@ -1,25 +1,199 @@
 /**
  * @file PitchDetector.cpp
- * @brief Autocorrelation-based pitch detection implementation
+ * @brief YIN pitch detection implementation (FFT difference function)
  */
 
 #include "PitchDetector.h"
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 // Helper function to calculate smoothing coefficient from time constant
 static float calculate_smoothing_coeff(float time_ms, float sample_rate) {
     return expf(-1000.0f / (time_ms * sample_rate));
 }
 
-// Autocorrelation function
-static float autocorrelate(const float* buffer, uint32_t size, uint32_t lag) {
-    float sum = 0.0f;
-    for (uint32_t i = 0; i < size - lag; i++) {
-        sum += buffer[i] * buffer[i + lag];
+#define YIN_THRESHOLD 0.15f          // First dip of d'(τ) below this is the period
+#define CONFIDENCE_THRESHOLD 0.5f    // Valid pitch needs 1 - d'(τ) above this
+
+/**
+ * Turn Z = FFT(x + i·y) into X_k · conj Y_k in place, so that the inverse
+ * transform yields the cross-correlation r(τ) = Σ_j y_j · x_{j+τ} (times N).
+ *
+ * X_k = (Z_k + conj Z_{N-k}) / 2 and Y_k = (Z_k - conj Z_{N-k}) / 2i. The
+ * product of two real signals' spectra is Hermitian, so both halves are
+ * filled from each (k, N-k) pair.
+ */
+static void cross_spectrum(const fft_t* fft, float* re, float* im) {
+    const uint32_t n = fft->size;
+
+    for (uint32_t k = 0; k <= n / 2; k++) {
+        const uint32_t m = (n - k) & (n - 1);
+        const float a = re[k], b = im[k];
+        const float c = re[m], d = im[m];
+
+        const float x_re = 0.5f * (a + c);
+        const float x_im = 0.5f * (b - d);
+        const float y_re = 0.5f * (b + d);
+        const float y_conj_im = 0.5f * (a - c);
+
+        const float p_re = x_re * y_re - x_im * y_conj_im;
+        const float p_im = x_re * y_conj_im + x_im * y_re;
+
+        re[k] = p_re;
+        im[k] = p_im;
+        re[m] = p_re;
+        im[m] = -p_im;
     }
-    return sum;
+}
+
+// Publish "no pitch" and end the analysis
+static void reject_analysis(pitch_detector_t* detector, float confidence) {
+    detector->pitch_valid = false;
+    detector->confidence = confidence;
+    detector->analysis_stage = PITCH_STAGE_IDLE;
+    // Keep smoothed pitch but decay confidence
+}
+
+/**
+ * Stage 1: snapshot the ring buffer and prepare the correlation inputs.
+ * Returns false (and publishes no pitch) if there is nothing to analyze.
+ */
+static bool begin_analysis(pitch_detector_t* detector) {
+    const uint32_t size = detector->buffer_size;
+    float* re = detector->fft_re;
+    float* im = detector->fft_im;
+    float* yin = detector->yin;
+
+    // Calculate min and max lag from frequency range
+    uint32_t min_lag = (uint32_t)(detector->sample_rate / detector->max_freq);
+    uint32_t max_lag = (uint32_t)(detector->sample_rate / detector->min_freq);
+
+    // Keep the window at least as long as the longest lag
+    if (min_lag < 1) min_lag = 1;
+    if (max_lag > size / 2) max_lag = size / 2;
+    if (min_lag >= max_lag) {
+        reject_analysis(detector, 0.0f);
+        return false;
+    }
+
+    const uint32_t window = size - max_lag;
+
+    // Linearize the ring buffer (oldest sample first), zero-padded
+    const uint32_t first = size - detector->buffer_index;
+    memcpy(re, detector->buffer + detector->buffer_index, first * sizeof(float));
+    memcpy(re + first, detector->buffer, detector->buffer_index * sizeof(float));
+    memset(re + size, 0, (detector->fft.size - size) * sizeof(float));
+
+    double energy = 0.0;
+    for (uint32_t i = 0; i < size; i++) {
+        energy += (double)re[i] * re[i];
+    }
+    if (energy < 1e-6) {
+        // Signal too quiet
+        reject_analysis(detector, 0.0f);
+        return false;
+    }
+
+    // Energy terms e_τ = Σ_{j<W} x_{j+τ}², sliding from e_0
+    double e = 0.0;
+    for (uint32_t j = 0; j < window; j++) {
+        e += (double)re[j] * re[j];
+    }
+    detector->analysis_e0 = (float)e;
+    yin[0] = (float)e;
+    for (uint32_t lag = 1; lag <= max_lag; lag++) {
+        e += (double)re[window + lag - 1] * re[window + lag - 1] -
+             (double)re[lag - 1] * re[lag - 1];
+        yin[lag] = (float)e;
+    }
+
+    // Window as the second real signal
+    memcpy(im, re, window * sizeof(float));
+    memset(im + window, 0, (detector->fft.size - window) * sizeof(float));
+
+    detector->analysis_min_lag = min_lag;
+    detector->analysis_max_lag = max_lag;
+    detector->analysis_stage = PITCH_STAGE_TRANSFORM;
+    return true;
+}
+
+// Stage 4: difference function, lag search and result
+static void finish_analysis(pitch_detector_t* detector) {
+    const float* re = detector->fft_re;
+    float* yin = detector->yin;
+    const uint32_t min_lag = detector->analysis_min_lag;
+    const uint32_t max_lag = detector->analysis_max_lag;
+
+    // d(τ) = e_0 + e_τ - 2·r(τ), then cumulative mean normalization
+    const float scale = 2.0f / (float)detector->fft.size;
+    double running_sum = 0.0;
+    yin[0] = 1.0f;
+    for (uint32_t lag = 1; lag <= max_lag; lag++) {
+        float d = detector->analysis_e0 + yin[lag] - scale * re[lag];
+        if (d < 0.0f) d = 0.0f;  // Rounding
+        running_sum += d;
+        yin[lag] = (running_sum > 0.0) ? (float)(d * lag / running_sum) : 1.0f;
+    }
+
+    // First dip below the threshold, followed down to its minimum
+    uint32_t best_lag = 0;
+    for (uint32_t lag = min_lag; lag <= max_lag; lag++) {
+        if (yin[lag] < YIN_THRESHOLD) {
+            while (lag + 1 <= max_lag && yin[lag + 1] < yin[lag]) {
+                lag++;
+            }
+            best_lag = lag;
+            break;
+        }
+    }
+
+    // Otherwise the global minimum
+    if (best_lag == 0) {
+        best_lag = min_lag;
+        for (uint32_t lag = min_lag + 1; lag <= max_lag; lag++) {
+            if (yin[lag] < yin[best_lag]) {
+                best_lag = lag;
+            }
+        }
+    }
+
+    // Parabolic interpolation for a sub-sample period
+    float period = (float)best_lag;
+    if (best_lag > 1 && best_lag < max_lag) {
+        float y0 = yin[best_lag - 1];
+        float y1 = yin[best_lag];
+        float y2 = yin[best_lag + 1];
+        float denom = y0 - 2.0f * y1 + y2;
+        if (denom > 0.0f) {
+            float shift = 0.5f * (y0 - y2) / denom;
+            if (fabsf(shift) < 1.0f) {
+                period += shift;
+            }
+        }
+    }
+
+    float confidence = 1.0f - yin[best_lag];
+    if (confidence < 0.0f) confidence = 0.0f;
+
+    // Check if dip is significant enough
+    if (confidence <= CONFIDENCE_THRESHOLD) {
+        reject_analysis(detector, confidence);
+        return;
+    }
+
+    // Valid pitch detected
+    detector->detected_pitch = detector->sample_rate / period;
+    detector->confidence = confidence;
+    detector->pitch_valid = true;
+    detector->analysis_stage = PITCH_STAGE_IDLE;
+
+    // Apply smoothing
+    detector->smoothed_pitch = detector->smoothing_coeff * detector->smoothed_pitch +
+                              (1.0f - detector->smoothing_coeff) * detector->detected_pitch;
 }
 
 void pitch_detector_init(pitch_detector_t* detector,
@@ -44,20 +218,191 @@ void pitch_detector_init(pitch_detector_t* detector,
     detector->buffer = (float*)calloc(detector->buffer_size, sizeof(float));
     detector->buffer_index = 0;
 
+    // Analysis scratch: the transform holds the whole linearized buffer
+    bool fft_ok = fft_init(&detector->fft, detector->buffer_size);
+    detector->fft_re = (float*)calloc(detector->fft.size, sizeof(float));
+    detector->fft_im = (float*)calloc(detector->fft.size, sizeof(float));
+    detector->yin = (float*)calloc(detector->buffer_size / 2 + 1, sizeof(float));
+
     detector->detected_pitch = 0.0f;
     detector->smoothed_pitch = 0.0f;
     detector->confidence = 0.0f;
     detector->pitch_valid = false;
 
-    // Calculate smoothing coefficient
+    // Calculate smoothing coefficient (one analysis per sample until told otherwise)
+    detector->smoothing_ms = smoothing_ms;
     detector->smoothing_coeff = calculate_smoothing_coeff(smoothing_ms, sample_rate);
 
-    detector->initialized = (detector->buffer != NULL);
+    detector->worker = NULL;
+    detector->analysis_stage = PITCH_STAGE_IDLE;
+    detector->analysis_min_lag = 0;
+    detector->analysis_max_lag = 0;
+    detector->analysis_e0 = 0.0f;
+
+    detector->initialized = (detector->buffer != NULL && fft_ok &&
+                             detector->fft_re != NULL && detector->fft_im != NULL &&
+                             detector->yin != NULL);
+}
+
+// Append samples to the analysis ring buffer
+static void store_samples(pitch_detector_t* detector,
+                          const float* input,
+                          uint32_t num_samples) {
+    // Only the last buffer_size samples survive
+    if (num_samples > detector->buffer_size) {
+        uint32_t skip = num_samples - detector->buffer_size;
+        detector->buffer_index = (detector->buffer_index + skip) % detector->buffer_size;
+        input += skip;
+        num_samples = detector->buffer_size;
+    }
+
+    // Copy into the circular buffer in at most two runs
+    uint32_t first = detector->buffer_size - detector->buffer_index;
+    if (first > num_samples) {
+        first = num_samples;
+    }
+    memcpy(detector->buffer + detector->buffer_index, input, first * sizeof(float));
+    memcpy(detector->buffer, input + first, (num_samples - first) * sizeof(float));
+
+    detector->buffer_index = (detector->buffer_index + num_samples) % detector->buffer_size;
+}
+
+// ============================================================================
+// Worker Thread
+// ============================================================================
+
+/**
+ * Background analysis state.
+ *
+ * Samples: SPSC ring, the audio thread writes, the worker reads. Positions
+ * count samples monotonically (wrapping uint32), index = pos & mask.
+ *
+ * Results: triple buffer. The worker fills its back slot and swaps it with
+ * the middle slot (flagged fresh); the audio thread swaps a fresh middle
+ * slot with its front slot and copies it to `current`, which the getters
+ * read. Each side owns one slot at all times, so neither ever waits or
+ * retries.
+ *
+ * The worker also owns the detector's smoothing coefficient while it runs,
+ * recomputing it whenever hop_samples changes.
+ */
+struct pitch_snapshot {
+    float pitch;
+    float smoothed_pitch;
+    float confidence;
+    bool valid;
+};
+
+#define SNAPSHOT_INDEX_MASK 3u
+#define SNAPSHOT_FRESH 4u                   // Middle slot holds an untaken result
+
+struct pitch_worker {
+    std::thread thread;
+    std::atomic<bool> running{false};
+    std::atomic<uint32_t> hop_samples{0};   ///< Samples between analyses
+
+    // Sample ring (audio thread → worker)
+    float* ring = nullptr;
+    uint32_t ring_mask = 0;
+    std::atomic<uint32_t> write_pos{0};
+    std::atomic<uint32_t> read_pos{0};
+
+    // Result triple buffer (worker → audio thread)
+    pitch_snapshot slots[3] = {};
+    std::atomic<uint32_t> middle{1};        ///< Middle slot index | SNAPSHOT_FRESH
+    uint32_t back = 0;                      ///< Worker's slot
+    uint32_t front = 2;                     ///< Audio thread's slot
+
+    pitch_snapshot current = {};            ///< Latest taken result (audio thread)
+};
+
+// Audio thread: queue samples for the worker (drops what does not fit)
+static void worker_push(pitch_worker* worker, const float* input, uint32_t num_samples) {
+    const uint32_t capacity = worker->ring_mask + 1;
+    const uint32_t write = worker->write_pos.load(std::memory_order_relaxed);
+    const uint32_t read = worker->read_pos.load(std::memory_order_acquire);
+
+    uint32_t space = capacity - (write - read);
+    if (num_samples > space) {
+        num_samples = space;
+    }
+
+    uint32_t index = write & worker->ring_mask;
+    uint32_t first = capacity - index;
+    if (first > num_samples) {
+        first = num_samples;
+    }
+    memcpy(worker->ring + index, input, first * sizeof(float));
+    memcpy(worker->ring, input + first, (num_samples - first) * sizeof(float));
+
+    worker->write_pos.store(write + num_samples, std::memory_order_release);
+}
+
+// Worker: move queued samples into the analysis buffer
+static uint32_t worker_drain(pitch_detector_t* detector, pitch_worker* worker) {
+    const uint32_t capacity = worker->ring_mask + 1;
+    const uint32_t read = worker->read_pos.load(std::memory_order_relaxed);
+    const uint32_t write = worker->write_pos.load(std::memory_order_acquire);
+    const uint32_t count = write - read;
+
+    uint32_t index = read & worker->ring_mask;
+    uint32_t first = capacity - index;
+    if (first > count) {
+        first = count;
+    }
+    store_samples(detector, worker->ring + index, first);
+    store_samples(detector, worker->ring, count - first);
+
+    worker->read_pos.store(write, std::memory_order_release);
+    return count;
+}
+
+// Snapshot of the detector's own result fields
+static pitch_snapshot detector_snapshot(const pitch_detector_t* detector) {
+    pitch_snapshot snapshot;
+    snapshot.pitch = detector->detected_pitch;
+    snapshot.smoothed_pitch = detector->smoothed_pitch;
+    snapshot.confidence = detector->confidence;
+    snapshot.valid = detector->pitch_valid;
+    return snapshot;
+}
+
+// Worker: publish the detector's latest result
+static void worker_publish(const pitch_detector_t* detector, pitch_worker* worker) {
+    worker->slots[worker->back] = detector_snapshot(detector);
+
+    const uint32_t previous = worker->middle.exchange(worker->back | SNAPSHOT_FRESH,
+                                                      std::memory_order_acq_rel);
+    worker->back = previous & SNAPSHOT_INDEX_MASK;
+}
+
+// Audio thread: move a fresh result to `current`
+static bool worker_take(pitch_worker* worker) {
+    if (!(worker->middle.load(std::memory_order_relaxed) & SNAPSHOT_FRESH)) {
+        return false;
+    }
+
+    const uint32_t previous = worker->middle.exchange(worker->front, std::memory_order_acq_rel);
+    worker->front = previous & SNAPSHOT_INDEX_MASK;
+    worker->current = worker->slots[worker->front];
+    return true;
+}
+
+// Smoothing coefficient for one analysis every interval_samples
+static void apply_analysis_interval(pitch_detector_t* detector, uint32_t interval_samples) {
+    // The smoother advances once per analysis, at sample_rate / interval
+    detector->smoothing_coeff = calculate_smoothing_coeff(
+        detector->smoothing_ms, detector->sample_rate / (float)interval_samples);
 }
 
 void pitch_detector_process(pitch_detector_t* detector, float input) {
     if (!detector || !detector->initialized) return;
 
+    if (detector->worker) {
+        worker_push(detector->worker, &input, 1);
+        return;
+    }
+
     // Add sample to circular buffer
     detector->buffer[detector->buffer_index] = input;
     detector->buffer_index = (detector->buffer_index + 1) % detector->buffer_size;
@@ -66,98 +411,229 @@ void pitch_detector_process(pitch_detector_t* detector, float input) {
 void pitch_detector_process_buffer(pitch_detector_t* detector,
                                    const float* input,
                                    uint32_t num_samples) {
-    if (!detector || !input) return;
+    if (!detector || !detector->initialized || !input) return;
+
+    if (detector->worker) {
+        worker_push(detector->worker, input, num_samples);
+        return;
+    }
+
+    store_samples(detector, input, num_samples);
+}
+
+bool pitch_detector_analyze_step(pitch_detector_t* detector) {
+    if (!detector || !detector->initialized) return true;
+
+    switch (detector->analysis_stage) {
+        case PITCH_STAGE_IDLE:
+            return !begin_analysis(detector);
+
+        case PITCH_STAGE_TRANSFORM:
+            fft_forward(&detector->fft, detector->fft_re, detector->fft_im);
+            detector->analysis_stage = PITCH_STAGE_CORRELATE;
+            return false;
+
+        case PITCH_STAGE_CORRELATE:
+            cross_spectrum(&detector->fft, detector->fft_re, detector->fft_im);
+            fft_inverse(&detector->fft, detector->fft_re, detector->fft_im);
+            detector->analysis_stage = PITCH_STAGE_SEARCH;
+            return false;
+
+        case PITCH_STAGE_SEARCH:
+            finish_analysis(detector);
+            return true;
+    }
+
+    return true;
+}
 
-    for (uint32_t i = 0; i < num_samples; i++) {
-        pitch_detector_process(detector, input[i]);
+// Run a whole analysis (or finish the pending one) on the calling thread
+static void run_analysis(pitch_detector_t* detector) {
+    while (!pitch_detector_analyze_step(detector)) {
     }
 }
 
 void pitch_detector_analyze(pitch_detector_t* detector) {
     if (!detector || !detector->initialized) return;
 
-    // Calculate min and max lag from frequency range
-    uint32_t min_lag = (uint32_t)(detector->sample_rate / detector->max_freq);
-    uint32_t max_lag = (uint32_t)(detector->sample_rate / detector->min_freq);
+    // The worker analyzes on its own
+    if (detector->worker) return;
 
-    // Ensure lags are within buffer bounds
-    if (min_lag < 1) min_lag = 1;
-    if (max_lag >= detector->buffer_size) max_lag = detector->buffer_size - 1;
+    run_analysis(detector);
+}
 
-    // Calculate autocorrelation at lag 0 for normalization
-    float r0 = autocorrelate(detector->buffer, detector->buffer_size, 0);
-    if (r0 < 1e-6f) {
-        // Signal too quiet
-        detector->pitch_valid = false;
-        detector->confidence = 0.0f;
-        return;
-    }
+bool pitch_detector_is_analyzing(const pitch_detector_t* detector) {
+    if (!detector || detector->worker) return false;
+    return detector->analysis_stage != PITCH_STAGE_IDLE;
+}
 
-    // Find maximum autocorrelation peak
-    float max_correlation = -1.0f;
-    uint32_t best_lag = 0;
+// Worker thread body: drain, analyze every hop, publish, sleep
+static void worker_main(pitch_detector_t* detector, pitch_worker* worker) {
+    uint32_t since_analysis = 0;
+    uint32_t smoothing_hop = 0;
 
-    for (uint32_t lag = min_lag; lag <= max_lag; lag++) {
-        float correlation = autocorrelate(detector->buffer, detector->buffer_size, lag);
-        float normalized = correlation / r0;
+    while (worker->running.load(std::memory_order_acquire)) {
+        const uint32_t hop = worker->hop_samples.load(std::memory_order_relaxed);
+        if (hop != smoothing_hop) {
+            apply_analysis_interval(detector, hop);
+            smoothing_hop = hop;
+        }
 
-        if (normalized > max_correlation) {
-            max_correlation = normalized;
-            best_lag = lag;
+        since_analysis += worker_drain(detector, worker);
+        if (since_analysis >= hop) {
+            since_analysis = 0;
+            run_analysis(detector);
+            worker_publish(detector, worker);
         }
+
+        // Poll at a quarter hop: bounded latency, no wakeups from the audio thread
+        float poll_ms = 250.0f * (float)hop / detector->sample_rate;
+        if (poll_ms < 1.0f) poll_ms = 1.0f;
+        std::this_thread::sleep_for(std::chrono::microseconds((long)(poll_ms * 1000.0f)));
     }
+}
 
-    // Check if peak is significant enough
-    const float CONFIDENCE_THRESHOLD = 0.3f;
-    if (max_correlation > CONFIDENCE_THRESHOLD && best_lag > 0) {
-        // Valid pitch detected
-        detector->detected_pitch = detector->sample_rate / (float)best_lag;
-        detector->confidence = max_correlation;
-        detector->pitch_valid = true;
+bool pitch_detector_start_worker(pitch_detector_t* detector, uint32_t hop_samples) {
+    if (!detector || !detector->initialized) return false;
+    if (hop_samples < 1) hop_samples = 1;
 
-        // Apply smoothing
-        detector->smoothed_pitch = detector->smoothing_coeff * detector->smoothed_pitch +
-                                  (1.0f - detector->smoothing_coeff) * detector->detected_pitch;
-    } else {
-        // No valid pitch
-        detector->pitch_valid = false;
-        detector->confidence = max_correlation;
-        // Keep smoothed pitch but decay confidence
+    if (detector->worker) {
+        // Already running: only retune (the worker rescales its smoothing)
+        detector->worker->hop_samples.store(hop_samples, std::memory_order_relaxed);
+        return true;
     }
+
+    pitch_worker* worker = new pitch_worker();
+
+    // Room for two analysis windows of backlog
+    uint32_t capacity = fft_next_pow2(2 * detector->buffer_size);
+    worker->ring = (float*)calloc(capacity, sizeof(float));
+    if (!worker->ring) {
+        delete worker;
+        return false;
+    }
+    worker->ring_mask = capacity - 1;
+    worker->hop_samples.store(hop_samples, std::memory_order_relaxed);
+
+    // Start from the detector's current result
+    const pitch_snapshot initial = detector_snapshot(detector);
+    for (pitch_snapshot& slot : worker->slots) {
+        slot = initial;
+    }
+    worker->current = initial;
+
+    detector->analysis_stage = PITCH_STAGE_IDLE;
+    worker->running.store(true, std::memory_order_release);
+    worker->thread = std::thread(worker_main, detector, worker);
+
+    detector->worker = worker;
+    return true;
+}
+
+void pitch_detector_stop_worker(pitch_detector_t* detector) {
+    if (!detector || !detector->worker) return;
+
+    pitch_worker* worker = detector->worker;
+    worker->running.store(false, std::memory_order_release);
+    if (worker->thread.joinable()) {
+        worker->thread.join();
+    }
+
+    // The worker published every analysis it ran, so the detector's own
+    // fields already hold the last result
+    free(worker->ring);
+    delete worker;
+    detector->worker = NULL;
+}
+
+bool pitch_detector_take_result(pitch_detector_t* detector) {
+    if (!detector || !detector->worker) return false;
+
+    return worker_take(detector->worker);
+}
+
+void pitch_detector_set_analysis_interval(pitch_detector_t* detector,
+                                          uint32_t interval_samples) {
+    if (!detector) return;
+    if (interval_samples < 1) interval_samples = 1;
+
+    // A running worker analyzes every hop and owns the smoothing
+    if (detector->worker) {
+        detector->worker->hop_samples.store(interval_samples, std::memory_order_relaxed);
+        return;
+    }
+
+    apply_analysis_interval(detector, interval_samples);
 }
 
 float pitch_detector_get_pitch(const pitch_detector_t* detector) {
-    if (!detector || !detector->pitch_valid) return 0.0f;
+    if (!detector) return 0.0f;
+
+    if (detector->worker) {
+        const pitch_snapshot* snapshot = &detector->worker->current;
+        return snapshot->valid ? snapshot->pitch : 0.0f;
+    }
+
+    if (!detector->pitch_valid) return 0.0f;
     return detector->detected_pitch;
 }
 
 float pitch_detector_get_smoothed_pitch(const pitch_detector_t* detector) {
-    if (!detector || !detector->pitch_valid) return 0.0f;
+    if (!detector) return 0.0f;
+
+    if (detector->worker) {
+        const pitch_snapshot* snapshot = &detector->worker->current;
+        return snapshot->valid ? snapshot->smoothed_pitch : 0.0f;
+    }
+
+    if (!detector->pitch_valid) return 0.0f;
     return detector->smoothed_pitch;
 }
 
 float pitch_detector_get_confidence(const pitch_detector_t* detector) {
     if (!detector) return 0.0f;
+
+    if (detector->worker) {
+        return detector->worker->current.confidence;
+    }
+
     return detector->confidence;
 }
 
 bool pitch_detector_is_valid(const pitch_detector_t* detector) {
     if (!detector) return false;
+
+    if (detector->worker) {
+        return detector->worker->current.valid;
+    }
+
     return detector->pitch_valid;
 }
 
 void pitch_detector_reset(pitch_detector_t* detector) {
     if (!detector || !detector->initialized) return;
 
+    // The worker owns the analysis buffer while it runs
+    uint32_t worker_hop = 0;
+    if (detector->worker) {
+        worker_hop = detector->worker->hop_samples.load(std::memory_order_relaxed);
+        pitch_detector_stop_worker(detector);
+    }
+
     detector->buffer_index = 0;
     detector->detected_pitch = 0.0f;
     detector->smoothed_pitch = 0.0f;
     detector->confidence = 0.0f;
     detector->pitch_valid = false;
+    detector->analysis_stage = PITCH_STAGE_IDLE;
 
     if (detector->buffer) {
         memset(detector->buffer, 0, detector->buffer_size * sizeof(float));
     }
+
+    if (worker_hop > 0) {
+        pitch_detector_start_worker(detector, worker_hop);
+    }
 }
 
 void pitch_detector_set_range(pitch_detector_t* detector,
@@ -171,10 +647,20 @@ void pitch_detector_set_range(pitch_detector_t* detector,
 void pitch_detector_cleanup(pitch_detector_t* detector) {
     if (!detector) return;
 
+    pitch_detector_stop_worker(detector);
+
     if (detector->buffer) {
         free(detector->buffer);
         detector->buffer = NULL;
     }
 
+    free(detector->fft_re);
+    free(detector->fft_im);
+    free(detector->yin);
+    detector->fft_re = NULL;
+    detector->fft_im = NULL;
+    detector->yin = NULL;
+    fft_cleanup(&detector->fft);
+
     detector->initialized = false;
 }
@@ -1,9 +1,36 @@
 /**
  * @file PitchDetector.h
- * @brief Autocorrelation-based pitch detection for morphing
+ * @brief YIN pitch detection for morphing
  *
- * Detects fundamental frequency of input signal using autocorrelation
- * with optional smoothing for stable pitch tracking.
+ * Detects fundamental frequency of input signal using the YIN difference
+ * function with optional smoothing for stable pitch tracking.
+ *
+ * The ring buffer is linearized and split into a window of W samples and
+ * the max_lag samples after it. The difference function
+ *
+ *     d(τ) = Σ_{j<W} (x_j - x_{j+τ})²  =  e_0 + e_τ - 2·r(τ)
+ *
+ * takes its energy terms from a running sum and the cross-correlation r(τ)
+ * of the window with the buffer from one FFT round trip (both real signals
+ * packed into one complex transform), so analysis is O(N log N) instead of
+ * one dot product per lag. The lag is the first dip of the cumulative mean
+ * normalized d'(τ) below the YIN threshold (else its global minimum),
+ * refined by parabolic interpolation.
+ *
+ * An analysis can also run in stages (pitch_detector_analyze_step()), so a
+ * caller can spread one analysis over several audio callbacks:
+ *
+ *     1. snapshot    linearize the ring, energy terms
+ *     2. transform   forward FFT
+ *     3. correlate   cross spectrum, inverse FFT
+ *     4. search      difference function, lag search, result
+ *
+ * Or it can run off the audio thread (pitch_detector_start_worker()): the
+ * process calls then only queue samples into a lock-free SPSC ring, a
+ * worker thread analyzes every hop and publishes each result through a
+ * triple buffer. pitch_detector_take_result() moves the latest one to the
+ * audio thread, and the getters return that copy until the next take.
+ * Neither side ever blocks or retries.
  */
 
 #ifndef PITCH_DETECTOR_H
@@ -11,11 +38,28 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "fft.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// Calls to pitch_detector_analyze_step() per analysis
+#define PITCH_ANALYSIS_STEPS 4
+
+// Background analysis state (opaque, see pitch_detector_start_worker())
+struct pitch_worker;
+
+/**
+ * @brief Next stage of a staged analysis
+ */
+typedef enum {
+    PITCH_STAGE_IDLE = 0,       ///< No analysis pending (next step snapshots)
+    PITCH_STAGE_TRANSFORM,      ///< Forward FFT
+    PITCH_STAGE_CORRELATE,      ///< Cross spectrum and inverse FFT
+    PITCH_STAGE_SEARCH          ///< Lag search and result
+} pitch_analysis_stage_t;
+
 /**
  * @brief Pitch detector state
  */
@@ -28,8 +72,18 @@ typedef struct {
     float max_freq;             ///< Maximum detectable frequency (Hz)
     float detected_pitch;       ///< Current detected pitch (Hz)
     float smoothed_pitch;       ///< Smoothed pitch for morphing (Hz)
-    float smoothing_coeff;      ///< Pitch smoothing coefficient
+    float smoothing_coeff;      ///< Pitch smoothing coefficient (per analysis)
+    float smoothing_ms;         ///< Pitch smoothing time in milliseconds
     float confidence;           ///< Detection confidence [0, 1]
+    fft_t fft;                  ///< FFT plan (size >= buffer_size)
+    float* fft_re;              ///< FFT scratch, real parts
+    float* fft_im;              ///< FFT scratch, imaginary parts
+    float* yin;                 ///< Difference function, buffer_size / 2 + 1 lags
+    pitch_analysis_stage_t analysis_stage; ///< Next stage of the pending analysis
+    uint32_t analysis_min_lag;  ///< Lag range of the pending analysis
+    uint32_t analysis_max_lag;
+    float analysis_e0;          ///< Window energy of the pending analysis
+    struct pitch_worker* worker;///< Background analysis (NULL = analyze on the caller's thread)
     bool initialized;           ///< Initialization flag
     bool pitch_valid;           ///< Valid pitch detected flag
 } pitch_detector_t;
@@ -74,12 +128,84 @@ void pitch_detector_process_buffer(pitch_detector_t* detector,
  * @brief Run pitch detection analysis
  *
  * Should be called periodically (e.g., every buffer) after processing samples.
- * This performs the autocorrelation analysis on the buffered data.
+ * This performs the YIN analysis on the buffered data. The longest lag is
+ * capped at half the buffer so the window is at least one period long.
+ * A pending staged analysis is completed instead of starting a new one.
  *
  * @param detector Pointer to detector structure
  */
 void pitch_detector_analyze(pitch_detector_t* detector);
 
+/**
+ * @brief Run the next stage of a staged analysis
+ *
+ * The first step snapshots the buffer; samples processed afterwards go into
+ * the next analysis. The result (pitch, confidence, validity) is published
+ * by the step that completes the analysis.
+ *
+ * @param detector Pointer to detector structure
+ * @return True if this step completed the analysis
+ */
+bool pitch_detector_analyze_step(pitch_detector_t* detector);
+
+/**
+ * @brief Check if a staged analysis is pending
+ *
+ * @param detector Pointer to detector structure
+ * @return True between the first and the completing analysis step
+ */
+bool pitch_detector_is_analyzing(const pitch_detector_t* detector);
+
+/**
+ * @brief Set the interval between analyses
+ *
+ * Rescales the pitch smoothing, which advances once per analysis, to the
+ * rate the caller actually analyzes at. With a worker running this sets
+ * the worker's hop instead, and the worker rescales its smoothing itself.
+ *
+ * @param detector Pointer to detector structure
+ * @param interval_samples Samples between analyses
+ */
+void pitch_detector_set_analysis_interval(pitch_detector_t* detector,
+                                          uint32_t interval_samples);
+
+/**
+ * @brief Move analysis to a background worker thread
+ *
+ * From now on the process calls only queue samples for the worker, which
+ * analyzes every hop_samples and publishes the result; analyze() and
+ * analyze_step() do nothing. If the worker is already running, only its
+ * hop is updated (one atomic store, safe while processing). Otherwise it
+ * allocates and starts a thread, so call it outside the audio callback and
+ * not concurrently with processing.
+ *
+ * @param detector Pointer to detector structure
+ * @param hop_samples Samples between analyses
+ * @return True if the worker is running
+ */
+bool pitch_detector_start_worker(pitch_detector_t* detector, uint32_t hop_samples);
+
+/**
+ * @brief Stop the worker and analyze on the caller's thread again
+ *
+ * Joins the thread; the last published result is kept. Same threading
+ * rules as pitch_detector_start_worker().
+ *
+ * @param detector Pointer to detector structure
+ */
+void pitch_detector_stop_worker(pitch_detector_t* detector);
+
+/**
+ * @brief Take the worker's latest result
+ *
+ * Call from the thread that processes samples, once per control point: the
+ * getters return the taken result until the next successful call.
+ *
+ * @param detector Pointer to detector structure
+ * @return True once per result published since the last call (false without worker)
+ */
+bool pitch_detector_take_result(pitch_detector_t* detector);
+
 /**
  * @brief Get detected pitch
  *
@@ -115,6 +241,8 @@ bool pitch_detector_is_valid(const pitch_detector_t* detector);
 /**
  * @brief Reset detector state
  *
+ * A running worker is stopped and restarted around the reset.
+ *
  * @param detector Pointer to detector structure
  */
 void pitch_detector_reset(pitch_detector_t* detector);
@@ -122,6 +250,8 @@ void pitch_detector_reset(pitch_detector_t* detector);
 /**
  * @brief Update frequency range
  *
+ * The worker reads the range, so change it while no worker runs.
+ *
  * @param detector Pointer to detector structure
  * @param min_freq Minimum detectable frequency (Hz)
  * @param max_freq Maximum detectable frequency (Hz)
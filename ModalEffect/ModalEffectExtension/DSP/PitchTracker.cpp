@@ -0,0 +1,282 @@
+/**
+ * @file PitchTracker.cpp
+ * @brief Shared incremental pitch tracking implementation
+ */
+
+#include "PitchTracker.h"
+#include "DenormalGuard.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DEFAULT_HOP_MS 20.0f         // Analysis hop until set_hop() is called
+#define ONSET_FAST_MS 5.0f           // Fast energy envelope time constant
+#define ONSET_SLOW_MS 100.0f         // Slow energy envelope time constant
+#define ONSET_RATIO 4.0f             // Fast over slow energy (+6 dB) marks an onset
+#define ONSET_FLOOR 1e-6f            // Minimum fast energy for an onset (-60 dB)
+
+// One-pole coefficient (per sample) for a time constant
+static float envelope_coeff(float time_ms, float sample_rate) {
+    return 1.0f - expf(-1000.0f / (time_ms * sample_rate));
+}
+
+// Largest hop that fits a hop request next to the spread bit
+#define MAX_HOP_SAMPLES (UINT32_MAX >> 1)
+
+// Smoothing coefficient per analysis at the current hop
+static void update_smoothing(pitch_tracker_t* tracker) {
+    float analysis_rate = tracker->sample_rate / (float)tracker->hop_samples;
+    tracker->smoothing_coeff = expf(-1000.0f / (tracker->smoothing_ms * analysis_rate));
+}
+
+// Snapshot a completed analysis and fold it into the smoothed pitch
+static void apply_result(pitch_tracker_t* tracker) {
+    const pitch_detector_t* detector = &tracker->detector;
+    tracker->valid = pitch_detector_is_valid(detector);
+    tracker->confidence = pitch_detector_get_confidence(detector);
+
+    float detected = pitch_detector_get_pitch(detector);
+    if (detected <= 0.0f) return;
+
+    // First pitch and the first one after an onset jump, others glide
+    if (tracker->pitch <= 0.0f || tracker->snap_next) {
+        tracker->pitch = detected;
+        tracker->snap_next = false;
+    } else {
+        tracker->pitch = tracker->smoothing_coeff * tracker->pitch +
+                         (1.0f - tracker->smoothing_coeff) * detected;
+    }
+}
+
+// Switch the analysis schedule (on the processing thread)
+static void apply_hop(pitch_tracker_t* tracker, uint32_t hop_samples, bool spread) {
+    tracker->hop_samples = hop_samples;
+    tracker->hop_counter = hop_samples;  // First analysis on the next update
+    tracker->spread = spread;
+    update_smoothing(tracker);
+
+    // Rescales the detector's smoothing, or retunes a running worker
+    pitch_detector_set_analysis_interval(&tracker->detector, hop_samples);
+}
+
+// Take over a hop published by pitch_tracker_set_hop()
+static void apply_hop_request(pitch_tracker_t* tracker) {
+    if (__atomic_load_n(&tracker->hop_request, __ATOMIC_RELAXED) == 0) return;
+
+    const uint32_t request = __atomic_exchange_n(&tracker->hop_request, 0, __ATOMIC_ACQUIRE);
+    if (request != 0) {
+        apply_hop(tracker, request >> 1, (request & 1) != 0);
+    }
+}
+
+void pitch_tracker_init(pitch_tracker_t* tracker,
+                        float sample_rate,
+                        float min_freq,
+                        float max_freq,
+                        float window_ms,
+                        float smoothing_ms) {
+    if (!tracker) return;
+
+    memset(tracker, 0, sizeof(*tracker));
+    tracker->sample_rate = sample_rate;
+
+    // Statistics cover the same window as the analysis
+    pitch_detector_init(&tracker->detector, sample_rate, min_freq, max_freq,
+                        window_ms, smoothing_ms);
+    tracker->window_size = tracker->detector.buffer_size;
+    tracker->crossings = (uint8_t*)calloc(tracker->window_size, sizeof(uint8_t));
+    tracker->squares = (float*)calloc(tracker->window_size, sizeof(float));
+
+    tracker->fast_coeff = envelope_coeff(ONSET_FAST_MS, sample_rate);
+    tracker->slow_coeff = envelope_coeff(ONSET_SLOW_MS, sample_rate);
+
+    tracker->smoothing_ms = smoothing_ms;
+    uint32_t hop_samples = (uint32_t)(DEFAULT_HOP_MS * 0.001f * sample_rate);
+    apply_hop(tracker, (hop_samples > 0) ? hop_samples : 1, false);
+
+    tracker->initialized = (tracker->detector.initialized &&
+                            tracker->crossings != NULL && tracker->squares != NULL);
+}
+
+void pitch_tracker_push(pitch_tracker_t* tracker,
+                        const float* input,
+                        uint32_t num_samples) {
+    if (!tracker || !tracker->initialized || !input) return;
+
+    apply_hop_request(tracker);
+    pitch_detector_process_buffer(&tracker->detector, input, num_samples);
+
+    // After an onset, analyze once half the window holds the new note
+    const uint32_t settle = tracker->window_size / 2;
+    const uint32_t onset_counter = (tracker->hop_samples > settle)
+                                 ? tracker->hop_samples - settle : 0;
+    uint32_t counted = num_samples;
+
+    uint32_t index = tracker->window_index;
+    float last = tracker->last_sample;
+    for (uint32_t i = 0; i < num_samples; i++) {
+        const float x = input[i];
+        const float square = x * x;
+
+        // Swap the oldest sample's contribution for this one's
+        const uint8_t crossed = ((last >= 0.0f) != (x >= 0.0f)) ? 1 : 0;
+        tracker->crossing_count += crossed;
+        tracker->crossing_count -= tracker->crossings[index];
+        tracker->crossings[index] = crossed;
+        tracker->energy_sum += (double)square - (double)tracker->squares[index];
+        tracker->squares[index] = square;
+        last = x;
+        if (++index == tracker->window_size) {
+            index = 0;
+        }
+
+        tracker->fast_energy += tracker->fast_coeff * (square - tracker->fast_energy);
+        tracker->slow_energy += tracker->slow_coeff * (square - tracker->slow_energy);
+
+        if (tracker->onset_holdoff > 0) {
+            tracker->onset_holdoff--;
+        } else if (tracker->fast_energy > ONSET_FLOOR &&
+                   tracker->fast_energy > ONSET_RATIO * tracker->slow_energy) {
+            tracker->onset = true;
+            tracker->snap_next = true;
+            tracker->onset_holdoff = tracker->window_size;
+            tracker->hop_counter = onset_counter;
+            counted = num_samples - 1 - i;
+        }
+    }
+    tracker->window_index = index;
+    tracker->last_sample = last;
+    tracker->fast_energy = denormal_snap(tracker->fast_energy);
+    tracker->slow_energy = denormal_snap(tracker->slow_energy);
+
+    // Saturates at the hop: the next update starts an analysis
+    uint32_t remaining = tracker->hop_samples - tracker->hop_counter;
+    tracker->hop_counter += (counted < remaining) ? counted : remaining;
+}
+
+bool pitch_tracker_update(pitch_tracker_t* tracker) {
+    if (!tracker || !tracker->initialized) return false;
+
+    apply_hop_request(tracker);
+
+    pitch_detector_t* detector = &tracker->detector;
+    bool completed = false;
+
+    if (detector->worker) {
+        completed = pitch_detector_take_result(detector);
+    } else if (pitch_detector_is_analyzing(detector)) {
+        completed = pitch_detector_analyze_step(detector);
+    } else if (tracker->hop_counter >= tracker->hop_samples) {
+        tracker->hop_counter = 0;
+
+        if (tracker->spread) {
+            completed = pitch_detector_analyze_step(detector);
+        } else {
+            pitch_detector_analyze(detector);
+            completed = true;
+        }
+    }
+
+    tracker->onset = false;
+
+    if (completed) {
+        apply_result(tracker);
+    }
+    return completed;
+}
+
+void pitch_tracker_set_hop(pitch_tracker_t* tracker, uint32_t hop_samples, bool spread) {
+    if (!tracker) return;
+    if (hop_samples < 1) hop_samples = 1;
+    if (hop_samples > MAX_HOP_SAMPLES) hop_samples = MAX_HOP_SAMPLES;
+
+    const uint32_t request = (hop_samples << 1) | (spread ? 1u : 0u);
+    __atomic_store_n(&tracker->hop_request, request, __ATOMIC_RELEASE);
+}
+
+bool pitch_tracker_set_worker(pitch_tracker_t* tracker, bool enabled) {
+    if (!tracker || !tracker->initialized) return false;
+
+    if (!enabled) {
+        pitch_detector_stop_worker(&tracker->detector);
+        return true;
+    }
+
+    // Start on the latest requested hop
+    apply_hop_request(tracker);
+
+    return pitch_detector_start_worker(&tracker->detector, tracker->hop_samples);
+}
+
+float pitch_tracker_get_pitch(const pitch_tracker_t* tracker) {
+    if (!tracker || !tracker->valid) return 0.0f;
+    return tracker->pitch;
+}
+
+float pitch_tracker_get_confidence(const pitch_tracker_t* tracker) {
+    if (!tracker) return 0.0f;
+    return tracker->confidence;
+}
+
+bool pitch_tracker_is_valid(const pitch_tracker_t* tracker) {
+    if (!tracker) return false;
+    return tracker->valid && tracker->pitch > 0.0f;
+}
+
+float pitch_tracker_get_zcr_pitch(const pitch_tracker_t* tracker) {
+    if (!tracker || tracker->window_size == 0) return 0.0f;
+
+    // Each crossing is half a cycle
+    return (float)tracker->crossing_count * tracker->sample_rate /
+           (2.0f * (float)tracker->window_size);
+}
+
+float pitch_tracker_get_rms(const pitch_tracker_t* tracker) {
+    if (!tracker || tracker->window_size == 0) return 0.0f;
+
+    // The running sum can drift a hair below zero on silence
+    double mean = tracker->energy_sum / (double)tracker->window_size;
+    return (mean > 0.0) ? (float)sqrt(mean) : 0.0f;
+}
+
+bool pitch_tracker_onset(const pitch_tracker_t* tracker) {
+    if (!tracker) return false;
+    return tracker->onset;
+}
+
+void pitch_tracker_reset(pitch_tracker_t* tracker) {
+    if (!tracker || !tracker->initialized) return;
+
+    pitch_detector_reset(&tracker->detector);
+
+    memset(tracker->crossings, 0, tracker->window_size * sizeof(uint8_t));
+    memset(tracker->squares, 0, tracker->window_size * sizeof(float));
+    tracker->window_index = 0;
+    tracker->crossing_count = 0;
+    tracker->energy_sum = 0.0;
+    tracker->last_sample = 0.0f;
+
+    tracker->fast_energy = 0.0f;
+    tracker->slow_energy = 0.0f;
+    tracker->onset_holdoff = 0;
+    tracker->onset = false;
+    tracker->snap_next = false;
+
+    tracker->pitch = 0.0f;
+    tracker->confidence = 0.0f;
+    tracker->valid = false;
+    tracker->hop_counter = tracker->hop_samples;
+}
+
+void pitch_tracker_cleanup(pitch_tracker_t* tracker) {
+    if (!tracker) return;
+
+    pitch_detector_cleanup(&tracker->detector);
+
+    free(tracker->crossings);
+    free(tracker->squares);
+    tracker->crossings = NULL;
+    tracker->squares = NULL;
+
+    tracker->initialized = false;
+}
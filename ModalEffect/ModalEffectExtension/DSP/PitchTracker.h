@@ -0,0 +1,217 @@
+/**
+ * @file PitchTracker.h
+ * @brief Shared incremental pitch tracking service
+ *
+ * One pitch tracker for every processor that follows the input pitch. It
+ * owns a YIN pitch detector and schedules its analyses on a hop (all at
+ * once, one stage per update, or on the detector's worker thread), and
+ * keeps cheap running statistics over the analysis window:
+ *
+ * - zero crossings and energy, updated per sample as samples enter and
+ *   leave the window (no rescan of the window), for a coarse zero-crossing
+ *   pitch estimate and the window RMS
+ * - fast and slow energy envelopes for onset detection
+ *
+ * Onset awareness: after an onset the next analysis starts as soon as the
+ * window is half filled with the new note (instead of waiting out the
+ * hop), and its result replaces the smoothed pitch rather than gliding
+ * from the previous note.
+ *
+ * Usage: pitch_tracker_push() on every input sample or block, then
+ * pitch_tracker_update() at the caller's control points (a control tick,
+ * an audio callback). The hop is counted in pushed samples. Each update
+ * that completes an analysis takes one snapshot of the detector's result,
+ * and the getters return it until the next one.
+ */
+
+#ifndef PITCH_TRACKER_H
+#define PITCH_TRACKER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "PitchDetector.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Pitch tracker state
+ */
+typedef struct pitch_tracker {
+    pitch_detector_t detector;  ///< YIN analysis (window = statistics window)
+    float sample_rate;          ///< Sample rate in Hz
+
+    // Analysis scheduler (in pushed samples)
+    uint32_t hop_samples;       ///< Samples between analysis starts
+    uint32_t hop_counter;       ///< Samples since the last analysis start
+    bool spread;                ///< One analysis stage per update (else all at once)
+    uint32_t hop_request;       ///< Pending set_hop(): hop << 1 | spread, 0 = none (atomic)
+
+    // Running window statistics
+    uint8_t* crossings;         ///< Ring: 1 where the sample crossed zero
+    float* squares;             ///< Ring: squared samples
+    uint32_t window_size;       ///< Ring length (detector buffer size)
+    uint32_t window_index;      ///< Next ring slot
+    uint32_t crossing_count;    ///< Zero crossings in the window
+    double energy_sum;          ///< Sum of squares in the window
+    float last_sample;          ///< Previous sample (crossing test)
+
+    // Onset detection
+    float fast_energy;          ///< Fast energy envelope (~5 ms)
+    float slow_energy;          ///< Slow energy envelope (~100 ms)
+    float fast_coeff;           ///< Fast envelope coefficient
+    float slow_coeff;           ///< Slow envelope coefficient
+    uint32_t onset_holdoff;     ///< Samples until the next onset can fire
+    bool onset;                 ///< Onset since the last update
+    bool snap_next;             ///< Next valid result replaces the smoothed pitch
+
+    // Result (detector snapshot, refreshed by pitch_tracker_update())
+    float pitch;                ///< Smoothed pitch (Hz, 0 = none yet)
+    float confidence;           ///< Confidence of the last analysis
+    bool valid;                 ///< Last analysis found a pitch
+    float smoothing_ms;         ///< Pitch smoothing time in milliseconds
+    float smoothing_coeff;      ///< Smoothing coefficient (per analysis)
+    bool initialized;           ///< Initialization flag
+} pitch_tracker_t;
+
+/**
+ * @brief Initialize pitch tracker
+ *
+ * Allocates the detector and the statistics rings (not real-time safe).
+ *
+ * @param tracker Pointer to tracker structure
+ * @param sample_rate Sample rate in Hz
+ * @param min_freq Minimum detectable frequency (Hz)
+ * @param max_freq Maximum detectable frequency (Hz)
+ * @param window_ms Analysis window in milliseconds
+ * @param smoothing_ms Pitch smoothing time in milliseconds
+ */
+void pitch_tracker_init(pitch_tracker_t* tracker,
+                        float sample_rate,
+                        float min_freq,
+                        float max_freq,
+                        float window_ms,
+                        float smoothing_ms);
+
+/**
+ * @brief Feed input samples
+ *
+ * Buffers them for analysis and updates the window statistics and onset
+ * envelopes incrementally.
+ *
+ * @param tracker Pointer to tracker structure
+ * @param input Input buffer
+ * @param num_samples Number of samples
+ */
+void pitch_tracker_push(pitch_tracker_t* tracker,
+                        const float* input,
+                        uint32_t num_samples);
+
+/**
+ * @brief Advance the analysis schedule
+ *
+ * Starts an analysis once a hop of samples has been pushed (sooner after
+ * an onset), runs the next stage of a spread analysis, or picks up the
+ * worker's latest result. Clears the onset flag.
+ *
+ * @param tracker Pointer to tracker structure
+ * @return True if a new analysis result was published
+ */
+bool pitch_tracker_update(pitch_tracker_t* tracker);
+
+/**
+ * @brief Configure the analysis schedule
+ *
+ * Only publishes the request (one atomic store); the next push or update
+ * on the processing thread takes it over, and the first analysis on the
+ * new hop starts on the next update. Safe to call from another thread
+ * while processing.
+ *
+ * @param tracker Pointer to tracker structure
+ * @param hop_samples Samples between analysis starts
+ * @param spread Run one analysis stage per update instead of all at once
+ */
+void pitch_tracker_set_hop(pitch_tracker_t* tracker, uint32_t hop_samples, bool spread);
+
+/**
+ * @brief Run analysis on the detector's background worker
+ *
+ * Starts or stops a thread, so call it outside the audio callback.
+ *
+ * @param tracker Pointer to tracker structure
+ * @param enabled Use the worker
+ * @return True if the requested mode is active
+ */
+bool pitch_tracker_set_worker(pitch_tracker_t* tracker, bool enabled);
+
+/**
+ * @brief Get tracked pitch
+ *
+ * @param tracker Pointer to tracker structure
+ * @return Smoothed pitch in Hz (0 if the last analysis found none)
+ */
+float pitch_tracker_get_pitch(const pitch_tracker_t* tracker);
+
+/**
+ * @brief Get confidence of the last analysis
+ *
+ * @param tracker Pointer to tracker structure
+ * @return Confidence value [0, 1]
+ */
+float pitch_tracker_get_confidence(const pitch_tracker_t* tracker);
+
+/**
+ * @brief Check if the last analysis found a pitch
+ *
+ * @param tracker Pointer to tracker structure
+ * @return True if valid pitch is detected
+ */
+bool pitch_tracker_is_valid(const pitch_tracker_t* tracker);
+
+/**
+ * @brief Coarse pitch from the window's zero-crossing rate
+ *
+ * Always available and costs nothing, but only meaningful for simple
+ * waveforms; use it as a fallback when the YIN result is invalid.
+ *
+ * @param tracker Pointer to tracker structure
+ * @return Frequency estimate in Hz
+ */
+float pitch_tracker_get_zcr_pitch(const pitch_tracker_t* tracker);
+
+/**
+ * @brief RMS level of the analysis window
+ *
+ * @param tracker Pointer to tracker structure
+ * @return RMS amplitude
+ */
+float pitch_tracker_get_rms(const pitch_tracker_t* tracker);
+
+/**
+ * @brief Check for an onset since the last update
+ *
+ * @param tracker Pointer to tracker structure
+ * @return True if an onset was detected in the samples pushed since then
+ */
+bool pitch_tracker_onset(const pitch_tracker_t* tracker);
+
+/**
+ * @brief Reset tracker state
+ *
+ * @param tracker Pointer to tracker structure
+ */
+void pitch_tracker_reset(pitch_tracker_t* tracker);
+
+/**
+ * @brief Clean up and free resources
+ *
+ * @param tracker Pointer to tracker structure
+ */
+void pitch_tracker_cleanup(pitch_tracker_t* tracker);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PITCH_TRACKER_H
@@ -5,6 +5,7 @@
 
 #include "ResonantBodyProcessor.h"
 #include "audio_synth.h"
+#include "DenormalGuard.h"
 #include <math.h>
 #include <string.h>
 
@@ -15,6 +16,12 @@ static const float DEFAULT_BASE_FREQS[MAX_RESONATORS] = {
     2400.0f   // High band base frequency
 };
 
+// Drive gain from band signal (scaled by energy and excite) to mode force
+static const float RESONATOR_DRIVE_GAIN = 16000.0f;
+
+// Filter engine lanes above this fraction of Nyquist are muted (they alias)
+static const float FILTER_MAX_NYQUIST_FRACTION = 0.95f;
+
 // Helper function to map body size to frequency multiplier
 static float body_size_to_freq_mult(float body_size) {
     // body_size: 0 = small (high pitch), 1 = large (low pitch)
@@ -52,6 +59,48 @@ static void configure_resonator_modes(modal_node_t* resonator,
     }
 }
 
+// Rebuild the filter engine lanes from the resonators' modes
+static void update_filter_lanes(resonant_body_processor_t* processor) {
+    const float inv_rate = 1.0f / processor->sample_rate;
+    const float max_omega = FILTER_MAX_NYQUIST_FRACTION * (float)M_PI * processor->sample_rate;
+
+    for (int r = 0; r < MAX_RESONATORS; r++) {
+        const modal_node_t* node = &processor->resonators[r];
+
+        for (int k = 0; k < MAX_MODES; k++) {
+            const int lane = r * MAX_MODES + k;
+            const mode_params_t* mode = &node->modes[k].params;
+
+            if (!mode->active || mode->omega >= max_omega) {
+                processor->filter_pole_re[lane] = 0.0f;
+                processor->filter_pole_im[lane] = 0.0f;
+                processor->filter_in_gain[lane] = 0.0f;
+                processor->filter_out_gain[lane] = 0.0f;
+                continue;
+            }
+
+            // Pole exp((-γ + iω)/fs). Re(y) answers a unit sinusoid at ω
+            // with amplitude 1 / (2(1 - |p|)), hence 2(1 - |p|) for unity
+            // gain at resonance
+            float radius = expf(-(mode->gamma + node->global_damping) * inv_rate);
+            float angle = mode->omega * inv_rate;
+            processor->filter_pole_re[lane] = radius * cosf(angle);
+            processor->filter_pole_im[lane] = radius * sinf(angle);
+            processor->filter_in_gain[lane] = 2.0f * (1.0f - radius);
+            processor->filter_out_gain[lane] = mode->weight * node->audio_gain;
+        }
+    }
+}
+
+// Wake a dormant resonator if its drive peak would make it audible
+static bool wake_resonator(resonant_body_processor_t* processor, int r, float drive_peak) {
+    if (!processor->resonator_dormant[r]) return true;
+    if (drive_peak < MODAL_NODE_SILENCE_LEVEL) return false;
+
+    processor->resonator_dormant[r] = false;
+    return true;
+}
+
 void resonant_body_init(resonant_body_processor_t* processor, float sample_rate) {
     if (!processor) return;
 
@@ -60,11 +109,12 @@ void resonant_body_init(resonant_body_processor_t* processor, float sample_rate)
     // Initialize DSP components
     energy_extractor_init(&processor->energy_extractor, sample_rate, 5.0f, 100.0f, 10.0f);
     spectral_analyzer_init(&processor->spectral_analyzer, sample_rate, 300.0f, 3000.0f);
-    pitch_detector_init(&processor->pitch_detector, sample_rate, 60.0f, 2000.0f, 50.0f, 100.0f);
+    pitch_tracker_init(&processor->pitch_tracker, sample_rate, 60.0f, 2000.0f, 50.0f, 100.0f);
 
     // Initialize resonators (one per frequency band)
     for (int i = 0; i < MAX_RESONATORS; i++) {
         modal_node_init(&processor->resonators[i], i, PERSONALITY_RESONATOR);
+        processor->resonator_dormant[i] = false;
         processor->base_freqs[i] = DEFAULT_BASE_FREQS[i];
     }
 
@@ -74,6 +124,7 @@ void resonant_body_init(resonant_body_processor_t* processor, float sample_rate)
     processor->params.excite = 0.5f;
     processor->params.morph = 0.0f;
     processor->params.mix = 0.5f;
+    processor->engine = RESONANT_BODY_ENGINE_MODAL;
 
     // Configure initial resonator settings
     float freq_mult = body_size_to_freq_mult(processor->params.body_size);
@@ -91,11 +142,175 @@ void resonant_body_init(resonant_body_processor_t* processor, float sample_rate)
 
     // Control rate: update every ~200 samples at 48kHz (~240Hz control rate)
     processor->control_rate_divisor = (uint32_t)(sample_rate / 240.0f);
+    if (processor->control_rate_divisor < 1) {
+        processor->control_rate_divisor = 1;
+    }
     processor->control_counter = 0;
 
+    // Pitch analysis on its own hop, decoupled from the modal update
+    processor->tracked_pitch = 0.0f;
+    processor->tracked_pitch_target = 0.0f;
+    processor->tracked_pitch_step = 0.0f;
+    processor->tracked_pitch_ramp = 0;
+    resonant_body_set_pitch_hop(processor, RESONANT_BODY_PITCH_HOP_MS, true);
+
+    // Integrate the resonators over the real tick length, so the input they
+    // are driven with between ticks lines up with each step
+    float tick_dt = (float)processor->control_rate_divisor / sample_rate;
+    for (int i = 0; i < MAX_RESONATORS; i++) {
+        modal_node_set_dt(&processor->resonators[i], tick_dt);
+    }
+
+    // Filter engine lanes (updated again at every tick)
+    memset(processor->filter_re, 0, sizeof(processor->filter_re));
+    memset(processor->filter_im, 0, sizeof(processor->filter_im));
+    update_filter_lanes(processor);
+
     processor->initialized = true;
 }
 
+// Advance the pitch tracker's schedule and ramp the tracked pitch towards
+// each new result
+static void schedule_pitch_analysis(resonant_body_processor_t* processor) {
+    pitch_tracker_t* tracker = &processor->pitch_tracker;
+
+    if (pitch_tracker_update(tracker) && pitch_tracker_is_valid(tracker)) {
+        // The hop is a whole number of ticks (resonant_body_set_pitch_hop())
+        const uint32_t hop_ticks = tracker->hop_samples / processor->control_rate_divisor;
+        float target = pitch_tracker_get_pitch(tracker);
+
+        if (processor->tracked_pitch <= 0.0f) {
+            // First result: jump
+            processor->tracked_pitch = target;
+            processor->tracked_pitch_ramp = 0;
+        } else {
+            processor->tracked_pitch_step = (target - processor->tracked_pitch) /
+                                            (float)hop_ticks;
+            processor->tracked_pitch_ramp = hop_ticks;
+        }
+        processor->tracked_pitch_target = target;
+    }
+
+    if (processor->tracked_pitch_ramp > 0) {
+        processor->tracked_pitch_ramp--;
+        processor->tracked_pitch = (processor->tracked_pitch_ramp > 0)
+                                 ? processor->tracked_pitch + processor->tracked_pitch_step
+                                 : processor->tracked_pitch_target;
+    }
+}
+
+// Control-rate update: pitch analysis, morphing and one modal step
+static void control_tick(resonant_body_processor_t* processor) {
+    // Analyze pitch
+    schedule_pitch_analysis(processor);
+
+    // Update resonator frequencies based on pitch tracking (morph parameter)
+    if (processor->params.morph > 0.01f && processor->tracked_pitch > 0.0f) {
+        float detected_pitch = processor->tracked_pitch;
+        float freq_mult = body_size_to_freq_mult(processor->params.body_size);
+
+        // Blend between fixed and tracked frequencies
+        for (int i = 0; i < MAX_RESONATORS; i++) {
+            float fixed_freq = processor->base_freqs[i] * freq_mult;
+            float tracked_freq = detected_pitch * (i + 1); // Harmonics of detected pitch
+            float final_freq = fixed_freq * (1.0f - processor->params.morph) +
+                              tracked_freq * processor->params.morph;
+
+            processor->resonators[i].carrier_freq_hz = final_freq;
+
+            // Update mode frequencies
+            float damping = material_to_damping(processor->params.material);
+            configure_resonator_modes(&processor->resonators[i], final_freq, 1.0f, damping);
+        }
+    }
+
+    if (processor->engine == RESONANT_BODY_ENGINE_FILTER) {
+        // Filter engine: the modes only supply the lane coefficients
+        update_filter_lanes(processor);
+        return;
+    }
+
+    // Update modal nodes; rung-out ones sleep until driven again (their
+    // step count still advances, it is the carrier phase)
+    for (int i = 0; i < MAX_RESONATORS; i++) {
+        if (processor->resonator_dormant[i]) {
+            processor->resonators[i].step_count++;
+            continue;
+        }
+
+        modal_node_step(&processor->resonators[i]);
+        processor->resonator_dormant[i] = modal_node_is_silent(&processor->resonators[i]);
+    }
+}
+
+/**
+ * Filter engine: run the band signals through the 12 resonator lanes and
+ * accumulate Re(y) into wet. Each resonator's 4 lanes share one band
+ * signal and are updated together (one 4-wide complex multiply-add per
+ * sample).
+ */
+static void filter_render(resonant_body_processor_t* processor,
+                          const float* const bands[NUM_BANDS],
+                          float* wet,
+                          uint32_t num_samples) {
+    const float excite = processor->params.excite;
+
+    for (int r = 0; r < MAX_RESONATORS; r++) {
+        const int base = r * MAX_MODES;
+        const float* band = bands[r];
+
+        // Skip a sleeping resonator while its band stays below the silence level
+        if (processor->resonator_dormant[r]) {
+            float peak = 0.0f;
+            for (uint32_t i = 0; i < num_samples; i++) {
+                peak = fmaxf(peak, fabsf(band[i]));
+            }
+            if (!wake_resonator(processor, r, peak * excite)) continue;
+        }
+
+        float y_re[MAX_MODES], y_im[MAX_MODES];
+        float p_re[MAX_MODES], p_im[MAX_MODES];
+        float in_gain[MAX_MODES], out_gain[MAX_MODES];
+        for (int k = 0; k < MAX_MODES; k++) {
+            y_re[k] = processor->filter_re[base + k];
+            y_im[k] = processor->filter_im[base + k];
+            p_re[k] = processor->filter_pole_re[base + k];
+            p_im[k] = processor->filter_pole_im[base + k];
+            in_gain[k] = processor->filter_in_gain[base + k] * excite;
+            out_gain[k] = processor->filter_out_gain[base + k];
+        }
+
+        for (uint32_t i = 0; i < num_samples; i++) {
+            const float x = band[i];
+            float sum = 0.0f;
+            for (int k = 0; k < MAX_MODES; k++) {
+                float re = y_re[k] * p_re[k] - y_im[k] * p_im[k] + in_gain[k] * x;
+                y_im[k] = y_re[k] * p_im[k] + y_im[k] * p_re[k];
+                y_re[k] = re;
+                sum += re * out_gain[k];
+            }
+            wet[i] += sum;
+        }
+
+        float magnitude = 0.0f;
+        for (int k = 0; k < MAX_MODES; k++) {
+            processor->filter_re[base + k] = denormal_snap(y_re[k]);
+            processor->filter_im[base + k] = denormal_snap(y_im[k]);
+            magnitude += fabsf(y_re[k]) + fabsf(y_im[k]);
+        }
+        processor->resonator_dormant[r] = (magnitude < MODAL_NODE_SILENCE_LEVEL);
+    }
+}
+
+// Carrier sample of a resonator (phase only advances with the step count)
+static float resonator_carrier(const resonant_body_processor_t* processor, int i) {
+    float phase = (float)processor->resonators[i].step_count *
+                 processor->resonators[i].carrier_freq_hz / processor->sample_rate;
+    phase = fmodf(phase, 1.0f) * 2.0f * M_PI;
+
+    return sinf(phase) * processor->resonators[i].audio_gain;
+}
+
 float resonant_body_process(resonant_body_processor_t* processor, float input) {
     if (!processor || !processor->initialized) return input;
 
@@ -106,75 +321,50 @@ float resonant_body_process(resonant_body_processor_t* processor, float input) {
     float band_outputs[NUM_BANDS];
     spectral_analyzer_process(&processor->spectral_analyzer, input, band_outputs);
 
-    // 3. Update pitch detector
-    pitch_detector_process(&processor->pitch_detector, input);
+    // 3. Update pitch tracker
+    pitch_tracker_push(&processor->pitch_tracker, &input, 1);
 
     // 4. Control rate updates
     processor->control_counter++;
     if (processor->control_counter >= processor->control_rate_divisor) {
         processor->control_counter = 0;
+        control_tick(processor);
+    }
 
-        // Analyze pitch
-        pitch_detector_analyze(&processor->pitch_detector);
-
-        // Update resonator frequencies based on pitch tracking (morph parameter)
-        if (processor->params.morph > 0.01f && pitch_detector_is_valid(&processor->pitch_detector)) {
-            float detected_pitch = pitch_detector_get_smoothed_pitch(&processor->pitch_detector);
-            float freq_mult = body_size_to_freq_mult(processor->params.body_size);
-
-            // Blend between fixed and tracked frequencies
-            for (int i = 0; i < MAX_RESONATORS; i++) {
-                float fixed_freq = processor->base_freqs[i] * freq_mult;
-                float tracked_freq = detected_pitch * (i + 1); // Harmonics of detected pitch
-                float final_freq = fixed_freq * (1.0f - processor->params.morph) +
-                                  tracked_freq * processor->params.morph;
-
-                processor->resonators[i].carrier_freq_hz = final_freq;
-
-                // Update mode frequencies
-                float damping = material_to_damping(processor->params.material);
-                configure_resonator_modes(&processor->resonators[i], final_freq, 1.0f, damping);
-            }
-        }
+    // 5-6. Filter engine: resonate the band signals directly
+    if (processor->engine == RESONANT_BODY_ENGINE_FILTER) {
+        const float* const bands[NUM_BANDS] = {
+            &band_outputs[BAND_LOW], &band_outputs[BAND_MID], &band_outputs[BAND_HIGH]
+        };
+        float wet_output = 0.0f;
+        filter_render(processor, bands, &wet_output, 1);
 
-        // Update modal nodes
-        for (int i = 0; i < MAX_RESONATORS; i++) {
-            modal_node_step(&processor->resonators[i]);
-        }
+        float dry_wet = processor->params.mix;
+        return input * (1.0f - dry_wet) + wet_output * dry_wet;
     }
 
-    // 5. Excite resonators with band-filtered signals scaled by energy and excite parameter
+    // 5. Drive resonators with band-filtered signals scaled by energy and excite parameter
     float excitation_scale = energy * processor->params.excite;
 
+    const float drive_scale = RESONATOR_DRIVE_GAIN / processor->sample_rate;
     for (int i = 0; i < MAX_RESONATORS; i++) {
-        // Create poke event from band output
-        if (fabsf(band_outputs[i]) > 0.001f) {
-            poke_event_t poke;
-            poke.source_node_id = 0;
-            poke.strength = fabsf(band_outputs[i]) * excitation_scale * 10.0f; // Scale for audibility
-            poke.phase_hint = (band_outputs[i] > 0.0f) ? 0.0f : M_PI;
-
-            // Equal weight to all modes
-            for (int m = 0; m < MAX_MODES; m++) {
-                poke.mode_weights[m] = 0.25f;
-            }
+        float drive = band_outputs[i] * excitation_scale;
+        if (!wake_resonator(processor, i, fabsf(drive) * drive_scale)) continue;
 
-            modal_node_apply_poke(&processor->resonators[i], &poke);
-        }
+        modal_node_drive(&processor->resonators[i], &drive, 1,
+                         processor->sample_rate, RESONATOR_DRIVE_GAIN);
     }
 
     // 6. Render audio from resonators
     float wet_output = 0.0f;
     for (int i = 0; i < MAX_RESONATORS; i++) {
+        if (processor->resonator_dormant[i]) continue;
+
         // Get amplitude from modal node
         float amp = modal_node_get_amplitude(&processor->resonators[i]);
 
         // Simple synthesis: use carrier frequency
-        float phase = (float)processor->resonators[i].step_count *
-                     processor->resonators[i].carrier_freq_hz / processor->sample_rate;
-        phase = fmodf(phase, 1.0f) * 2.0f * M_PI;
-
-        wet_output += amp * sinf(phase) * processor->resonators[i].audio_gain;
+        wet_output += amp * resonator_carrier(processor, i);
     }
 
     // 7. Mix dry and wet signals
@@ -184,6 +374,153 @@ float resonant_body_process(resonant_body_processor_t* processor, float input) {
     return output;
 }
 
+// ============================================================================
+// Block Pipeline
+// ============================================================================
+
+/**
+ * Excitation + synthesis stages for block samples [start, end), all between
+ * two control ticks.
+ *
+ * The band signals drive the resonators continuously (modal_node_drive());
+ * the mode state, and so the amplitude and carrier, only change at ticks.
+ */
+static void drive_and_render(resonant_body_processor_t* processor,
+                             uint32_t start, uint32_t end) {
+    if (start >= end) return;
+
+    const float* energy = processor->block_energy;
+    float* drive = processor->block_drive;
+    float* wet = processor->block_wet;
+    const float excite = processor->params.excite;
+    const float drive_scale = RESONATOR_DRIVE_GAIN / processor->sample_rate;
+
+    for (int r = 0; r < MAX_RESONATORS; r++) {
+        modal_node_t* node = &processor->resonators[r];
+        const float* band = processor->block_bands[r];
+
+        // Excitation: band signal scaled by the energy envelope
+        float peak = 0.0f;
+        for (uint32_t i = start; i < end; i++) {
+            drive[i] = band[i] * energy[i] * excite;
+            peak = fmaxf(peak, fabsf(drive[i]));
+        }
+        if (!wake_resonator(processor, r, peak * drive_scale)) continue;
+        modal_node_drive(node, drive + start, end - start,
+                         processor->sample_rate, RESONATOR_DRIVE_GAIN);
+
+        // Synthesis: constant until the next tick
+        const float level = modal_node_get_amplitude(node) * resonator_carrier(processor, r);
+        for (uint32_t i = start; i < end; i++) {
+            wet[i] += level;
+        }
+    }
+}
+
+/**
+ * Filter engine stages for block samples [start, end), all between two
+ * control ticks (the lane coefficients only change at ticks).
+ */
+static void filter_render_range(resonant_body_processor_t* processor,
+                                uint32_t start, uint32_t end) {
+    if (start >= end) return;
+
+    const float* const bands[NUM_BANDS] = {
+        processor->block_bands[BAND_LOW] + start,
+        processor->block_bands[BAND_MID] + start,
+        processor->block_bands[BAND_HIGH] + start
+    };
+    filter_render(processor, bands, processor->block_wet + start, end - start);
+}
+
+// Synthesis of block samples [start, end) with the selected engine
+static void render_range(resonant_body_processor_t* processor,
+                         uint32_t start, uint32_t end) {
+    if (processor->engine == RESONANT_BODY_ENGINE_FILTER) {
+        filter_render_range(processor, start, end);
+    } else {
+        drive_and_render(processor, start, end);
+    }
+}
+
+// Run all stages over one block of at most RESONANT_BODY_BLOCK_SIZE samples
+static void process_chunk(resonant_body_processor_t* processor,
+                          const float* input,
+                          float* output,
+                          uint32_t num_samples) {
+    // 1-2. Energy envelope and band split (independent of control ticks)
+    energy_extractor_process_buffer(&processor->energy_extractor, input,
+                                    processor->block_energy, num_samples);
+    spectral_analyzer_process_buffer(&processor->spectral_analyzer, input,
+                                     processor->block_bands[BAND_LOW],
+                                     processor->block_bands[BAND_MID],
+                                     processor->block_bands[BAND_HIGH],
+                                     num_samples);
+
+    memset(processor->block_wet, 0, num_samples * sizeof(float));
+
+    // 3-6. Pitch fill, excitation and synthesis, split at control ticks.
+    // A tick on sample t sees the pitch buffer up to t and runs before the
+    // excitation of sample t.
+    uint32_t filled = 0;
+    uint32_t rendered = 0;
+    while (filled < num_samples) {
+        uint32_t count = processor->control_rate_divisor - processor->control_counter;
+        if (count > num_samples - filled) {
+            count = num_samples - filled;
+        }
+
+        pitch_tracker_push(&processor->pitch_tracker, input + filled, count);
+        filled += count;
+        processor->control_counter += count;
+
+        if (processor->control_counter >= processor->control_rate_divisor) {
+            processor->control_counter = 0;
+
+            render_range(processor, rendered, filled - 1);
+            rendered = filled - 1;
+            control_tick(processor);
+        }
+    }
+    render_range(processor, rendered, num_samples);
+
+    // 7. Mix dry and wet signals
+    const float dry_wet = processor->params.mix;
+    const float* wet = processor->block_wet;
+    for (uint32_t i = 0; i < num_samples; i++) {
+        output[i] = input[i] * (1.0f - dry_wet) + wet[i] * dry_wet;
+    }
+}
+
+void resonant_body_process_block(resonant_body_processor_t* processor,
+                                 const float* input,
+                                 float* output,
+                                 uint32_t num_samples) {
+    if (!processor || !input || !output) return;
+
+    if (!processor->initialized) {
+        if (output != input) {
+            memmove(output, input, num_samples * sizeof(float));
+        }
+        return;
+    }
+
+    // Flush decay tails to zero for the whole call
+    denormal_guard_t guard;
+    denormal_guard_enter(&guard);
+
+    for (uint32_t offset = 0; offset < num_samples; offset += RESONANT_BODY_BLOCK_SIZE) {
+        uint32_t count = num_samples - offset;
+        if (count > RESONANT_BODY_BLOCK_SIZE) {
+            count = RESONANT_BODY_BLOCK_SIZE;
+        }
+
+        process_chunk(processor, input + offset, output + offset, count);
+    }
+
+    denormal_guard_leave(&guard);
+}
+
 void resonant_body_process_buffer(resonant_body_processor_t* processor,
                                   const float* input_L,
                                   const float* input_R,
@@ -192,14 +529,22 @@ void resonant_body_process_buffer(resonant_body_processor_t* processor,
                                   uint32_t num_samples) {
     if (!processor || !input_L || !input_R || !output_L || !output_R) return;
 
-    for (uint32_t i = 0; i < num_samples; i++) {
+    for (uint32_t offset = 0; offset < num_samples; offset += RESONANT_BODY_BLOCK_SIZE) {
+        uint32_t count = num_samples - offset;
+        if (count > RESONANT_BODY_BLOCK_SIZE) {
+            count = RESONANT_BODY_BLOCK_SIZE;
+        }
+
         // Process as mono (sum L+R)
-        float mono_input = (input_L[i] + input_R[i]) * 0.5f;
-        float mono_output = resonant_body_process(processor, mono_input);
+        float* mono = processor->block_input;
+        for (uint32_t i = 0; i < count; i++) {
+            mono[i] = (input_L[offset + i] + input_R[offset + i]) * 0.5f;
+        }
+
+        resonant_body_process_block(processor, mono, output_L + offset, count);
 
         // Output to both channels
-        output_L[i] = mono_output;
-        output_R[i] = mono_output;
+        memcpy(output_R + offset, output_L + offset, count * sizeof(float));
     }
 }
 
@@ -250,25 +595,71 @@ void resonant_body_set_mix(resonant_body_processor_t* processor, float mix) {
     processor->params.mix = fmaxf(0.0f, fminf(1.0f, mix));
 }
 
+void resonant_body_set_pitch_hop(resonant_body_processor_t* processor,
+                                 float hop_ms,
+                                 bool spread) {
+    if (!processor) return;
+
+    float hop_samples = fmaxf(0.0f, hop_ms) * 0.001f * processor->sample_rate;
+    uint32_t hop_ticks = (uint32_t)(hop_samples / (float)processor->control_rate_divisor + 0.5f);
+    if (hop_ticks < 1) {
+        hop_ticks = 1;
+    }
+
+    // The tracker counts the hop in samples; with ticks in between updates
+    // an analysis starts on every hop_ticks-th tick
+    pitch_tracker_set_hop(&processor->pitch_tracker,
+                          hop_ticks * processor->control_rate_divisor, spread);
+}
+
+bool resonant_body_set_pitch_worker(resonant_body_processor_t* processor, bool enabled) {
+    if (!processor || !processor->initialized) return false;
+
+    // Same hop as the tick scheduler; the ramp still spans one hop
+    return pitch_tracker_set_worker(&processor->pitch_tracker, enabled);
+}
+
+void resonant_body_set_engine(resonant_body_processor_t* processor,
+                              resonant_body_engine_t engine) {
+    if (!processor || processor->engine == engine) return;
+
+    processor->engine = engine;
+
+    // Filter lanes start silent, coefficients from the current modes
+    memset(processor->filter_re, 0, sizeof(processor->filter_re));
+    memset(processor->filter_im, 0, sizeof(processor->filter_im));
+    memset(processor->resonator_dormant, 0, sizeof(processor->resonator_dormant));
+    if (processor->initialized) {
+        update_filter_lanes(processor);
+    }
+}
+
 void resonant_body_reset(resonant_body_processor_t* processor) {
     if (!processor) return;
 
     energy_extractor_reset(&processor->energy_extractor);
     spectral_analyzer_reset(&processor->spectral_analyzer);
-    pitch_detector_reset(&processor->pitch_detector);
+    pitch_tracker_reset(&processor->pitch_tracker);
 
     for (int i = 0; i < MAX_RESONATORS; i++) {
         modal_node_reset(&processor->resonators[i]);
+        processor->resonator_dormant[i] = false;
     }
 
+    memset(processor->filter_re, 0, sizeof(processor->filter_re));
+    memset(processor->filter_im, 0, sizeof(processor->filter_im));
+
     processor->control_counter = 0;
+    processor->tracked_pitch = 0.0f;
+    processor->tracked_pitch_target = 0.0f;
+    processor->tracked_pitch_ramp = 0;
 }
 
 void resonant_body_cleanup(resonant_body_processor_t* processor) {
     if (!processor) return;
 
     energy_extractor_cleanup(&processor->energy_extractor);
-    pitch_detector_cleanup(&processor->pitch_detector);
+    pitch_tracker_cleanup(&processor->pitch_tracker);
 
     processor->initialized = false;
 }
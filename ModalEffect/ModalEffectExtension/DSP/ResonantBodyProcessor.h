@@ -4,6 +4,30 @@
  *
  * Integrates energy extraction, spectral analysis, pitch detection,
  * and modal resonators to create a physical-modeled resonant body effect.
+ *
+ * resonant_body_process() runs the whole chain for one sample. The buffer
+ * entry points run it block by block instead: each stage (energy, filter
+ * bank, pitch buffer fill, excitation, synthesis, mix) loops over the block
+ * on its own, with the block split only at control ticks. Both paths
+ * produce the same output (up to sub -120 dB input that a sleeping
+ * resonator skips per sample but picks up per block).
+ *
+ * Pitch comes from the shared pitch tracker (PitchTracker.h), whose
+ * analysis runs on its own hop rather than at every control tick
+ * (resonant_body_set_pitch_hop()), optionally one stage per tick or on a
+ * background thread (resonant_body_set_pitch_worker()); the morphed
+ * resonators follow a pitch ramped between analysis results.
+ *
+ * Two engines render the wet signal:
+ * - MODAL: the band signals drive the modal nodes, which are stepped at
+ *   control rate; each resonator plays its amplitude on a carrier sine.
+ * - FILTER: every mode of every resonator is a complex one-pole resonator
+ *   at audio rate, y ← y·exp((-γ + iω)/fs) + x, filtering its band signal
+ *   directly (3 resonators × 4 modes = 12 lanes).
+ *
+ * In either engine a resonator that has rung out (summed mode magnitude
+ * below -120 dB) sleeps: it is not stepped or rendered until its band
+ * drive is loud enough to lift it above that level again.
  */
 
 #ifndef RESONANT_BODY_PROCESSOR_H
@@ -13,7 +37,7 @@
 #include <stdbool.h>
 #include "EnergyExtractor.h"
 #include "SpectralAnalyzer.h"
-#include "PitchDetector.h"
+#include "PitchTracker.h"
 #include "modal_node.h"
 
 #ifdef __cplusplus
@@ -23,6 +47,23 @@ extern "C" {
 // Maximum number of resonators (one per frequency band)
 #define MAX_RESONATORS 3
 
+// Block pipeline scratch size (longer buffers are processed in chunks)
+#define RESONANT_BODY_BLOCK_SIZE 256
+
+// Default interval between pitch analyses (independent of the control rate)
+#define RESONANT_BODY_PITCH_HOP_MS 20.0f
+
+// Audio-rate resonator lanes of the filter engine (one per mode)
+#define RESONANT_BODY_FILTER_LANES (MAX_RESONATORS * MAX_MODES)
+
+/**
+ * @brief Wet signal engines
+ */
+typedef enum {
+    RESONANT_BODY_ENGINE_MODAL = 0,  ///< Control-rate modal nodes + carrier sine (default)
+    RESONANT_BODY_ENGINE_FILTER      ///< Audio-rate complex resonator per mode
+} resonant_body_engine_t;
+
 /**
  * @brief Effect parameters
  */
@@ -43,13 +84,23 @@ typedef struct {
     // DSP components
     energy_extractor_t energy_extractor;  ///< Energy envelope follower
     spectral_analyzer_t spectral_analyzer;///< 3-band filter bank
-    pitch_detector_t pitch_detector;      ///< Pitch detection
+    pitch_tracker_t pitch_tracker;        ///< Pitch tracking (shared service)
 
     // Modal resonators (one per band)
     modal_node_t resonators[MAX_RESONATORS];
+    bool resonator_dormant[MAX_RESONATORS]; ///< Rung out, skipped until driven
 
     // Parameters
     resonant_body_params_t params;
+    resonant_body_engine_t engine;
+
+    // Filter engine lanes (lane = resonator * MAX_MODES + mode)
+    float filter_re[RESONANT_BODY_FILTER_LANES];      ///< Re(y)
+    float filter_im[RESONANT_BODY_FILTER_LANES];      ///< Im(y)
+    float filter_pole_re[RESONANT_BODY_FILTER_LANES]; ///< Re(exp((-γ + iω)/fs))
+    float filter_pole_im[RESONANT_BODY_FILTER_LANES]; ///< Im(exp((-γ + iω)/fs))
+    float filter_in_gain[RESONANT_BODY_FILTER_LANES]; ///< Input gain (unity peak gain)
+    float filter_out_gain[RESONANT_BODY_FILTER_LANES];///< Output gain (weight · audio_gain)
 
     // Base frequencies for each band (Hz)
     float base_freqs[MAX_RESONATORS];
@@ -58,6 +109,19 @@ typedef struct {
     uint32_t control_counter;
     uint32_t control_rate_divisor;
 
+    // Tracked pitch, ramped between analyses (hop in control ticks)
+    float tracked_pitch;            ///< Pitch the resonators follow (Hz, 0 = none yet)
+    float tracked_pitch_target;     ///< Latest analysis result (Hz)
+    float tracked_pitch_step;       ///< Per-tick ramp increment (Hz)
+    uint32_t tracked_pitch_ramp;    ///< Ticks left on the ramp
+
+    // Block pipeline scratch buffers (one block per stage, no allocation)
+    float block_input[RESONANT_BODY_BLOCK_SIZE];            ///< Mono input
+    float block_energy[RESONANT_BODY_BLOCK_SIZE];           ///< Energy envelope
+    float block_bands[NUM_BANDS][RESONANT_BODY_BLOCK_SIZE]; ///< Band outputs
+    float block_drive[RESONANT_BODY_BLOCK_SIZE];            ///< Resonator drive signal
+    float block_wet[RESONANT_BODY_BLOCK_SIZE];              ///< Wet output
+
     // State
     bool initialized;
 } resonant_body_processor_t;
@@ -79,6 +143,22 @@ void resonant_body_init(resonant_body_processor_t* processor, float sample_rate)
  */
 float resonant_body_process(resonant_body_processor_t* processor, float input);
 
+/**
+ * @brief Process a mono buffer with the block pipeline
+ *
+ * Equivalent to calling resonant_body_process() on every sample.
+ * input and output may alias.
+ *
+ * @param processor Pointer to processor structure
+ * @param input Input buffer
+ * @param output Output buffer
+ * @param num_samples Number of samples to process
+ */
+void resonant_body_process_block(resonant_body_processor_t* processor,
+                                 const float* input,
+                                 float* output,
+                                 uint32_t num_samples);
+
 /**
  * @brief Process a buffer of samples (stereo)
  *
@@ -136,6 +216,50 @@ void resonant_body_set_morph(resonant_body_processor_t* processor, float morph);
  */
 void resonant_body_set_mix(resonant_body_processor_t* processor, float mix);
 
+/**
+ * @brief Configure the pitch analysis schedule
+ *
+ * Pitch analysis starts every hop instead of at every control tick. With
+ * spread, one analysis is split into PITCH_ANALYSIS_STEPS stages run on
+ * consecutive ticks, so no single callback pays for a whole analysis; the
+ * effective hop is then at least that many ticks. Between results the
+ * tracked pitch ramps linearly to the latest one over one hop.
+ *
+ * The pitch tracker takes the new hop over on the audio thread, so this
+ * may be called while processing.
+ *
+ * @param processor Pointer to processor structure
+ * @param hop_ms Interval between analysis starts in milliseconds (default: 20 ms)
+ * @param spread Spread each analysis over several ticks (default: true)
+ */
+void resonant_body_set_pitch_hop(resonant_body_processor_t* processor,
+                                 float hop_ms,
+                                 bool spread);
+
+/**
+ * @brief Run pitch analysis on a background thread
+ *
+ * When enabled, the audio thread only queues samples for the pitch
+ * tracker's worker (see pitch_tracker_set_worker()), which analyzes
+ * every pitch hop; each control tick picks up the latest published result.
+ * Starts or joins a thread: call outside the audio callback and not
+ * concurrently with processing.
+ *
+ * @param processor Pointer to processor structure
+ * @param enabled True for the worker thread, false to analyze on the audio thread
+ * @return True if the requested mode is active
+ */
+bool resonant_body_set_pitch_worker(resonant_body_processor_t* processor, bool enabled);
+
+/**
+ * @brief Select the wet signal engine
+ *
+ * @param processor Pointer to processor structure
+ * @param engine Engine to render with
+ */
+void resonant_body_set_engine(resonant_body_processor_t* processor,
+                              resonant_body_engine_t engine);
+
 /**
  * @brief Reset processor state
  *
@@ -1,9 +1,10 @@
 /**
  * @file SpectralAnalyzer.cpp
- * @brief 3-band biquad filter bank implementation
+ * @brief Biquad filter bank implementation (SoA, transposed Direct Form II)
  */
 
 #include "SpectralAnalyzer.h"
+#include "DenormalGuard.h"
 #include <math.h>
 #include <string.h>
 
@@ -11,91 +12,177 @@
 #define M_PI 3.14159265358979323846
 #endif
 
+// Same policy as the NEON sine kernel in audio_synth_simd.c: the NEON path
+// has not been built and run on hardware yet, so it is opt-in with
+// SPECTRAL_ENABLE_NEON (CMake: MODAL_EFFECT_ENABLE_NEON) until
+// spectral_analyzer_test passes on AArch64. Scalar is used otherwise.
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+#define SPECTRAL_HAVE_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(SPECTRAL_ENABLE_NEON)
+#define SPECTRAL_HAVE_NEON 1
+#include <arm_neon.h>
+#endif
+
 // ============================================================================
-// Biquad Filter Utilities
+// Biquad Design
 // ============================================================================
 
-static void biquad_reset(biquad_t* filter) {
-    if (!filter) return;
-    filter->x1 = filter->x2 = 0.0f;
-    filter->y1 = filter->y2 = 0.0f;
+#define BUTTERWORTH_Q 0.707f           // 2nd-order Butterworth bands
+#define LINKWITZ_RILEY_Q 0.70710678f   // Exact 1/√2 so LP + HP sums to allpass
+
+/**
+ * @brief Normalized biquad coefficients (a0 = 1)
+ */
+typedef struct {
+    float b0, b1, b2;
+    float a1, a2;
+} biquad_coeffs_t;
+
+static biquad_coeffs_t normalize(float a0, float a1, float a2,
+                                 float b0, float b1, float b2) {
+    biquad_coeffs_t c;
+    c.a1 = a1 / a0;
+    c.a2 = a2 / a0;
+    c.b0 = b0 / a0;
+    c.b1 = b1 / a0;
+    c.b2 = b2 / a0;
+    return c;
 }
 
-static float biquad_process(biquad_t* filter, float input) {
-    if (!filter) return input;
+// 2nd-order lowpass
+static biquad_coeffs_t design_lowpass(float cutoff_hz, float Q, float sample_rate) {
+    float omega = 2.0f * M_PI * cutoff_hz / sample_rate;
+    float cos_omega = cosf(omega);
+    float alpha = sinf(omega) / (2.0f * Q);
 
-    // Direct Form II Transposed
-    float output = filter->b0 * input + filter->b1 * filter->x1 + filter->b2 * filter->x2
-                   - filter->a1 * filter->y1 - filter->a2 * filter->y2;
+    return normalize(1.0f + alpha, -2.0f * cos_omega, 1.0f - alpha,
+                     (1.0f - cos_omega) / 2.0f, 1.0f - cos_omega, (1.0f - cos_omega) / 2.0f);
+}
 
-    // Update state
-    filter->x2 = filter->x1;
-    filter->x1 = input;
-    filter->y2 = filter->y1;
-    filter->y1 = output;
+// 2nd-order highpass
+static biquad_coeffs_t design_highpass(float cutoff_hz, float Q, float sample_rate) {
+    float omega = 2.0f * M_PI * cutoff_hz / sample_rate;
+    float cos_omega = cosf(omega);
+    float alpha = sinf(omega) / (2.0f * Q);
 
-    return output;
+    return normalize(1.0f + alpha, -2.0f * cos_omega, 1.0f - alpha,
+                     (1.0f + cos_omega) / 2.0f, -(1.0f + cos_omega), (1.0f + cos_omega) / 2.0f);
 }
 
-// Configure biquad as 2nd-order Butterworth lowpass
-static void biquad_lowpass(biquad_t* filter, float cutoff_hz, float sample_rate) {
-    if (!filter) return;
+// 2nd-order bandpass (constant 0 dB peak gain)
+static biquad_coeffs_t design_bandpass(float center_hz, float bandwidth, float sample_rate) {
+    float omega = 2.0f * M_PI * center_hz / sample_rate;
+    float cos_omega = cosf(omega);
+    float Q = center_hz / bandwidth;
+    float alpha = sinf(omega) / (2.0f * Q);
+
+    return normalize(1.0f + alpha, -2.0f * cos_omega, 1.0f - alpha,
+                     alpha, 0.0f, -alpha);
+}
 
+// 2nd-order allpass
+static biquad_coeffs_t design_allpass(float cutoff_hz, float Q, float sample_rate) {
     float omega = 2.0f * M_PI * cutoff_hz / sample_rate;
     float cos_omega = cosf(omega);
-    float sin_omega = sinf(omega);
-    float alpha = sin_omega / (2.0f * 0.707f); // Q = 0.707 for Butterworth
+    float alpha = sinf(omega) / (2.0f * Q);
 
-    float a0 = 1.0f + alpha;
-    filter->a1 = (-2.0f * cos_omega) / a0;
-    filter->a2 = (1.0f - alpha) / a0;
+    return normalize(1.0f + alpha, -2.0f * cos_omega, 1.0f - alpha,
+                     1.0f - alpha, -2.0f * cos_omega, 1.0f + alpha);
+}
 
-    filter->b0 = ((1.0f - cos_omega) / 2.0f) / a0;
-    filter->b1 = (1.0f - cos_omega) / a0;
-    filter->b2 = ((1.0f - cos_omega) / 2.0f) / a0;
+static biquad_coeffs_t identity_stage(void) {
+    return normalize(1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+}
 
-    biquad_reset(filter);
+// Store coefficients into one stage of one lane
+static void set_stage(spectral_analyzer_t* analyzer, uint32_t stage, uint32_t lane,
+                      biquad_coeffs_t c) {
+    analyzer->b0[stage][lane] = c.b0;
+    analyzer->b1[stage][lane] = c.b1;
+    analyzer->b2[stage][lane] = c.b2;
+    analyzer->a1[stage][lane] = c.a1;
+    analyzer->a2[stage][lane] = c.a2;
 }
 
-// Configure biquad as 2nd-order Butterworth highpass
-static void biquad_highpass(biquad_t* filter, float cutoff_hz, float sample_rate) {
-    if (!filter) return;
+// One 2nd-order section per band (original design)
+static void configure_butterworth(spectral_analyzer_t* analyzer) {
+    const uint32_t last = analyzer->num_bands - 1;
+    const float sr = analyzer->sample_rate;
 
-    float omega = 2.0f * M_PI * cutoff_hz / sample_rate;
-    float cos_omega = cosf(omega);
-    float sin_omega = sinf(omega);
-    float alpha = sin_omega / (2.0f * 0.707f); // Q = 0.707 for Butterworth
+    analyzer->num_stages = 1;
 
-    float a0 = 1.0f + alpha;
-    filter->a1 = (-2.0f * cos_omega) / a0;
-    filter->a2 = (1.0f - alpha) / a0;
+    set_stage(analyzer, 0, 0, design_lowpass(analyzer->crossovers[0], BUTTERWORTH_Q, sr));
 
-    filter->b0 = ((1.0f + cos_omega) / 2.0f) / a0;
-    filter->b1 = -(1.0f + cos_omega) / a0;
-    filter->b2 = ((1.0f + cos_omega) / 2.0f) / a0;
+    // Bandpass centered between adjacent crossovers
+    for (uint32_t band = 1; band < last; band++) {
+        float lo = analyzer->crossovers[band - 1];
+        float hi = analyzer->crossovers[band];
+        set_stage(analyzer, 0, band, design_bandpass(sqrtf(lo * hi), hi - lo, sr));
+    }
 
-    biquad_reset(filter);
+    set_stage(analyzer, 0, last, design_highpass(analyzer->crossovers[last - 1], BUTTERWORTH_Q, sr));
 }
 
-// Configure biquad as 2nd-order bandpass
-static void biquad_bandpass(biquad_t* filter, float center_hz, float bandwidth, float sample_rate) {
-    if (!filter) return;
-
-    float omega = 2.0f * M_PI * center_hz / sample_rate;
-    float cos_omega = cosf(omega);
-    float sin_omega = sinf(omega);
-    float Q = center_hz / bandwidth;
-    float alpha = sin_omega / (2.0f * Q);
+// LR4 crossover tree, one flattened cascade per band
+static void configure_linkwitz_riley(spectral_analyzer_t* analyzer) {
+    const uint32_t num_bands = analyzer->num_bands;
+    const uint32_t num_crossovers = num_bands - 1;
+    const float sr = analyzer->sample_rate;
+
+    // The top band has the deepest cascade: every crossover's HP, twice
+    analyzer->num_stages = 2 * num_crossovers;
+
+    for (uint32_t band = 0; band < num_bands; band++) {
+        uint32_t stage = 0;
+
+        // HP of every crossover below the band (LR4 = two sections)
+        for (uint32_t j = 0; j < band; j++) {
+            biquad_coeffs_t hp = design_highpass(analyzer->crossovers[j], LINKWITZ_RILEY_Q, sr);
+            set_stage(analyzer, stage++, band, hp);
+            set_stage(analyzer, stage++, band, hp);
+        }
+
+        if (band < num_crossovers) {
+            // LP of the crossover above the band
+            biquad_coeffs_t lp = design_lowpass(analyzer->crossovers[band], LINKWITZ_RILEY_Q, sr);
+            set_stage(analyzer, stage++, band, lp);
+            set_stage(analyzer, stage++, band, lp);
+
+            // Phase compensation for the splits further up the tree
+            for (uint32_t j = band + 1; j < num_crossovers; j++) {
+                set_stage(analyzer, stage++, band,
+                          design_allpass(analyzer->crossovers[j], LINKWITZ_RILEY_Q, sr));
+            }
+        }
+
+        while (stage < analyzer->num_stages) {
+            set_stage(analyzer, stage++, band, identity_stage());
+        }
+    }
+}
 
-    float a0 = 1.0f + alpha;
-    filter->a1 = (-2.0f * cos_omega) / a0;
-    filter->a2 = (1.0f - alpha) / a0;
+// Design every lane from analyzer->crossovers and clear the filter state
+static void configure_bank(spectral_analyzer_t* analyzer) {
+    const uint32_t last = analyzer->num_bands - 1;
+
+    // Padding lanes stay silent (zero coefficients)
+    memset(analyzer->b0, 0, sizeof(analyzer->b0));
+    memset(analyzer->b1, 0, sizeof(analyzer->b1));
+    memset(analyzer->b2, 0, sizeof(analyzer->b2));
+    memset(analyzer->a1, 0, sizeof(analyzer->a1));
+    memset(analyzer->a2, 0, sizeof(analyzer->a2));
+
+    if (analyzer->filter_type == SPECTRAL_FILTER_LR4) {
+        configure_linkwitz_riley(analyzer);
+    } else {
+        configure_butterworth(analyzer);
+    }
 
-    filter->b0 = alpha / a0;
-    filter->b1 = 0.0f;
-    filter->b2 = -alpha / a0;
+    analyzer->crossover_low = analyzer->crossovers[0];
+    analyzer->crossover_high = analyzer->crossovers[last - 1];
 
-    biquad_reset(filter);
+    spectral_analyzer_reset(analyzer);
 }
 
 // ============================================================================
@@ -109,18 +196,41 @@ void spectral_analyzer_init(spectral_analyzer_t* analyzer,
     if (!analyzer) return;
 
     analyzer->sample_rate = sample_rate;
-    analyzer->crossover_low = crossover_low;
-    analyzer->crossover_high = crossover_high;
+    analyzer->num_bands = NUM_BANDS;
+    analyzer->num_lanes = SPECTRAL_LANE_WIDTH;
+    analyzer->filter_type = SPECTRAL_FILTER_BUTTERWORTH;
+    analyzer->crossovers[0] = crossover_low;
+    analyzer->crossovers[1] = crossover_high;
 
-    // Configure filters
-    biquad_lowpass(&analyzer->low_pass, crossover_low, sample_rate);
+    configure_bank(analyzer);
 
-    // Bandpass centered between crossovers
-    float center_freq = sqrtf(crossover_low * crossover_high);
-    float bandwidth = crossover_high - crossover_low;
-    biquad_bandpass(&analyzer->band_pass, center_freq, bandwidth, sample_rate);
+    analyzer->initialized = true;
+}
+
+void spectral_analyzer_init_bands(spectral_analyzer_t* analyzer,
+                                  float sample_rate,
+                                  uint32_t num_bands,
+                                  float min_freq,
+                                  float max_freq) {
+    if (!analyzer) return;
+
+    if (num_bands < 2) num_bands = 2;
+    if (num_bands > SPECTRAL_MAX_BANDS) num_bands = SPECTRAL_MAX_BANDS;
+
+    analyzer->sample_rate = sample_rate;
+    analyzer->num_bands = num_bands;
+    analyzer->num_lanes = (num_bands + SPECTRAL_LANE_WIDTH - 1) &
+                          ~(uint32_t)(SPECTRAL_LANE_WIDTH - 1);
+    analyzer->filter_type = SPECTRAL_FILTER_BUTTERWORTH;
+
+    // Log-spaced crossovers from min_freq to max_freq
+    const uint32_t num_crossovers = num_bands - 1;
+    for (uint32_t i = 0; i < num_crossovers; i++) {
+        float t = (num_crossovers > 1) ? (float)i / (float)(num_crossovers - 1) : 0.0f;
+        analyzer->crossovers[i] = min_freq * powf(max_freq / min_freq, t);
+    }
 
-    biquad_highpass(&analyzer->high_pass, crossover_high, sample_rate);
+    configure_bank(analyzer);
 
     analyzer->initialized = true;
 }
@@ -130,9 +240,230 @@ void spectral_analyzer_process(spectral_analyzer_t* analyzer,
                               float band_outputs[NUM_BANDS]) {
     if (!analyzer || !analyzer->initialized || !band_outputs) return;
 
-    band_outputs[BAND_LOW] = biquad_process(&analyzer->low_pass, input);
-    band_outputs[BAND_MID] = biquad_process(&analyzer->band_pass, input);
-    band_outputs[BAND_HIGH] = biquad_process(&analyzer->high_pass, input);
+    float* outputs[SPECTRAL_MAX_BANDS];
+    for (uint32_t band = 0; band < analyzer->num_bands; band++) {
+        outputs[band] = &band_outputs[band];
+    }
+    spectral_analyzer_process_bands(analyzer, &input, outputs, 1);
+}
+
+// ============================================================================
+// Lane Kernels (one group of SPECTRAL_LANE_WIDTH bands over a whole buffer)
+// ============================================================================
+
+/**
+ * Run lanes [base, base + 4) through all stages over the buffer, writing the
+ * first num_out of them to their band buffers.
+ */
+#if defined(SPECTRAL_HAVE_SSE2)
+// Single section (Butterworth bank), state kept in registers
+static void process_group_single(spectral_analyzer_t* analyzer, uint32_t base, uint32_t num_out,
+                                 const float* input, float* const* band_outputs,
+                                 uint32_t num_samples) {
+    const __m128 b0 = _mm_loadu_ps(&analyzer->b0[0][base]);
+    const __m128 b1 = _mm_loadu_ps(&analyzer->b1[0][base]);
+    const __m128 b2 = _mm_loadu_ps(&analyzer->b2[0][base]);
+    const __m128 a1 = _mm_loadu_ps(&analyzer->a1[0][base]);
+    const __m128 a2 = _mm_loadu_ps(&analyzer->a2[0][base]);
+    __m128 s1 = _mm_loadu_ps(&analyzer->s1[0][base]);
+    __m128 s2 = _mm_loadu_ps(&analyzer->s2[0][base]);
+
+    for (uint32_t i = 0; i < num_samples; i++) {
+        const __m128 x = _mm_set1_ps(input[i]);
+        const __m128 y = _mm_add_ps(_mm_mul_ps(b0, x), s1);
+        s1 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(b1, x), _mm_mul_ps(a1, y)), s2);
+        s2 = _mm_sub_ps(_mm_mul_ps(b2, x), _mm_mul_ps(a2, y));
+
+        float out[SPECTRAL_LANE_WIDTH];
+        _mm_storeu_ps(out, y);
+        for (uint32_t k = 0; k < num_out; k++) {
+            band_outputs[base + k][i] = out[k];
+        }
+    }
+
+    _mm_storeu_ps(&analyzer->s1[0][base], s1);
+    _mm_storeu_ps(&analyzer->s2[0][base], s2);
+}
+
+// Any number of sections, one sample through the whole cascade at a time
+static void process_group_cascade(spectral_analyzer_t* analyzer, uint32_t base, uint32_t num_out,
+                                  const float* input, float* const* band_outputs,
+                                  uint32_t num_samples) {
+    const uint32_t num_stages = analyzer->num_stages;
+    __m128 b0[SPECTRAL_MAX_STAGES], b1[SPECTRAL_MAX_STAGES], b2[SPECTRAL_MAX_STAGES];
+    __m128 a1[SPECTRAL_MAX_STAGES], a2[SPECTRAL_MAX_STAGES];
+    __m128 s1[SPECTRAL_MAX_STAGES], s2[SPECTRAL_MAX_STAGES];
+
+    for (uint32_t st = 0; st < num_stages; st++) {
+        b0[st] = _mm_loadu_ps(&analyzer->b0[st][base]);
+        b1[st] = _mm_loadu_ps(&analyzer->b1[st][base]);
+        b2[st] = _mm_loadu_ps(&analyzer->b2[st][base]);
+        a1[st] = _mm_loadu_ps(&analyzer->a1[st][base]);
+        a2[st] = _mm_loadu_ps(&analyzer->a2[st][base]);
+        s1[st] = _mm_loadu_ps(&analyzer->s1[st][base]);
+        s2[st] = _mm_loadu_ps(&analyzer->s2[st][base]);
+    }
+
+    for (uint32_t i = 0; i < num_samples; i++) {
+        __m128 x = _mm_set1_ps(input[i]);
+
+        for (uint32_t st = 0; st < num_stages; st++) {
+            const __m128 y = _mm_add_ps(_mm_mul_ps(b0[st], x), s1[st]);
+            s1[st] = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(b1[st], x), _mm_mul_ps(a1[st], y)), s2[st]);
+            s2[st] = _mm_sub_ps(_mm_mul_ps(b2[st], x), _mm_mul_ps(a2[st], y));
+            x = y;
+        }
+
+        float out[SPECTRAL_LANE_WIDTH];
+        _mm_storeu_ps(out, x);
+        for (uint32_t k = 0; k < num_out; k++) {
+            band_outputs[base + k][i] = out[k];
+        }
+    }
+
+    for (uint32_t st = 0; st < num_stages; st++) {
+        _mm_storeu_ps(&analyzer->s1[st][base], s1[st]);
+        _mm_storeu_ps(&analyzer->s2[st][base], s2[st]);
+    }
+}
+#elif defined(SPECTRAL_HAVE_NEON)
+// Single section (Butterworth bank), state kept in registers
+static void process_group_single(spectral_analyzer_t* analyzer, uint32_t base, uint32_t num_out,
+                                 const float* input, float* const* band_outputs,
+                                 uint32_t num_samples) {
+    const float32x4_t b0 = vld1q_f32(&analyzer->b0[0][base]);
+    const float32x4_t b1 = vld1q_f32(&analyzer->b1[0][base]);
+    const float32x4_t b2 = vld1q_f32(&analyzer->b2[0][base]);
+    const float32x4_t a1 = vld1q_f32(&analyzer->a1[0][base]);
+    const float32x4_t a2 = vld1q_f32(&analyzer->a2[0][base]);
+    float32x4_t s1 = vld1q_f32(&analyzer->s1[0][base]);
+    float32x4_t s2 = vld1q_f32(&analyzer->s2[0][base]);
+
+    for (uint32_t i = 0; i < num_samples; i++) {
+        const float32x4_t x = vdupq_n_f32(input[i]);
+        const float32x4_t y = vmlaq_f32(s1, b0, x);
+        s1 = vaddq_f32(vmlsq_f32(vmulq_f32(b1, x), a1, y), s2);
+        s2 = vmlsq_f32(vmulq_f32(b2, x), a2, y);
+
+        float out[SPECTRAL_LANE_WIDTH];
+        vst1q_f32(out, y);
+        for (uint32_t k = 0; k < num_out; k++) {
+            band_outputs[base + k][i] = out[k];
+        }
+    }
+
+    vst1q_f32(&analyzer->s1[0][base], s1);
+    vst1q_f32(&analyzer->s2[0][base], s2);
+}
+
+// Any number of sections, one sample through the whole cascade at a time
+static void process_group_cascade(spectral_analyzer_t* analyzer, uint32_t base, uint32_t num_out,
+                                  const float* input, float* const* band_outputs,
+                                  uint32_t num_samples) {
+    const uint32_t num_stages = analyzer->num_stages;
+    float32x4_t b0[SPECTRAL_MAX_STAGES], b1[SPECTRAL_MAX_STAGES], b2[SPECTRAL_MAX_STAGES];
+    float32x4_t a1[SPECTRAL_MAX_STAGES], a2[SPECTRAL_MAX_STAGES];
+    float32x4_t s1[SPECTRAL_MAX_STAGES], s2[SPECTRAL_MAX_STAGES];
+
+    for (uint32_t st = 0; st < num_stages; st++) {
+        b0[st] = vld1q_f32(&analyzer->b0[st][base]);
+        b1[st] = vld1q_f32(&analyzer->b1[st][base]);
+        b2[st] = vld1q_f32(&analyzer->b2[st][base]);
+        a1[st] = vld1q_f32(&analyzer->a1[st][base]);
+        a2[st] = vld1q_f32(&analyzer->a2[st][base]);
+        s1[st] = vld1q_f32(&analyzer->s1[st][base]);
+        s2[st] = vld1q_f32(&analyzer->s2[st][base]);
+    }
+
+    for (uint32_t i = 0; i < num_samples; i++) {
+        float32x4_t x = vdupq_n_f32(input[i]);
+
+        for (uint32_t st = 0; st < num_stages; st++) {
+            const float32x4_t y = vmlaq_f32(s1[st], b0[st], x);
+            s1[st] = vaddq_f32(vmlsq_f32(vmulq_f32(b1[st], x), a1[st], y), s2[st]);
+            s2[st] = vmlsq_f32(vmulq_f32(b2[st], x), a2[st], y);
+            x = y;
+        }
+
+        float out[SPECTRAL_LANE_WIDTH];
+        vst1q_f32(out, x);
+        for (uint32_t k = 0; k < num_out; k++) {
+            band_outputs[base + k][i] = out[k];
+        }
+    }
+
+    for (uint32_t st = 0; st < num_stages; st++) {
+        vst1q_f32(&analyzer->s1[st][base], s1[st]);
+        vst1q_f32(&analyzer->s2[st][base], s2[st]);
+    }
+}
+#endif
+
+#if defined(SPECTRAL_HAVE_SSE2) || defined(SPECTRAL_HAVE_NEON)
+static void process_group(spectral_analyzer_t* analyzer, uint32_t base, uint32_t num_out,
+                          const float* input, float* const* band_outputs,
+                          uint32_t num_samples) {
+    if (analyzer->num_stages == 1) {
+        process_group_single(analyzer, base, num_out, input, band_outputs, num_samples);
+    } else {
+        process_group_cascade(analyzer, base, num_out, input, band_outputs, num_samples);
+    }
+}
+#else
+static void process_group(spectral_analyzer_t* analyzer, uint32_t base, uint32_t num_out,
+                          const float* input, float* const* band_outputs,
+                          uint32_t num_samples) {
+    for (uint32_t k = 0; k < num_out; k++) {
+        const uint32_t lane = base + k;
+        float* out = band_outputs[lane];
+
+        // Stage by stage over the whole buffer (in place in the output)
+        const float* x = input;
+        for (uint32_t st = 0; st < analyzer->num_stages; st++) {
+            const float b0 = analyzer->b0[st][lane], b1 = analyzer->b1[st][lane];
+            const float b2 = analyzer->b2[st][lane];
+            const float a1 = analyzer->a1[st][lane], a2 = analyzer->a2[st][lane];
+            float s1 = analyzer->s1[st][lane], s2 = analyzer->s2[st][lane];
+
+            for (uint32_t i = 0; i < num_samples; i++) {
+                const float in = x[i];
+                const float y = b0 * in + s1;
+                s1 = b1 * in - a1 * y + s2;
+                s2 = b2 * in - a2 * y;
+                out[i] = y;
+            }
+
+            analyzer->s1[st][lane] = s1;
+            analyzer->s2[st][lane] = s2;
+            x = out;
+        }
+    }
+}
+#endif
+
+void spectral_analyzer_process_bands(spectral_analyzer_t* analyzer,
+                                     const float* input,
+                                     float* const* band_outputs,
+                                     uint32_t num_samples) {
+    if (!analyzer || !analyzer->initialized || !input || !band_outputs) return;
+
+    // Groups of SPECTRAL_LANE_WIDTH bands, each over the whole buffer
+    for (uint32_t base = 0; base < analyzer->num_lanes; base += SPECTRAL_LANE_WIDTH) {
+        uint32_t num_out = analyzer->num_bands - base;
+        if (num_out > SPECTRAL_LANE_WIDTH) {
+            num_out = SPECTRAL_LANE_WIDTH;
+        }
+
+        process_group(analyzer, base, num_out, input, band_outputs, num_samples);
+    }
+
+    // Decayed histories go to exact zero rather than through denormals
+    for (uint32_t st = 0; st < analyzer->num_stages; st++) {
+        for (uint32_t lane = 0; lane < analyzer->num_lanes; lane++) {
+            analyzer->s1[st][lane] = denormal_snap(analyzer->s1[st][lane]);
+            analyzer->s2[st][lane] = denormal_snap(analyzer->s2[st][lane]);
+        }
+    }
 }
 
 void spectral_analyzer_process_buffer(spectral_analyzer_t* analyzer,
@@ -143,38 +474,32 @@ void spectral_analyzer_process_buffer(spectral_analyzer_t* analyzer,
                                       uint32_t num_samples) {
     if (!analyzer || !input || !low_output || !mid_output || !high_output) return;
 
-    for (uint32_t i = 0; i < num_samples; i++) {
-        float band_outputs[NUM_BANDS];
-        spectral_analyzer_process(analyzer, input[i], band_outputs);
-
-        low_output[i] = band_outputs[BAND_LOW];
-        mid_output[i] = band_outputs[BAND_MID];
-        high_output[i] = band_outputs[BAND_HIGH];
-    }
+    float* const outputs[NUM_BANDS] = { low_output, mid_output, high_output };
+    spectral_analyzer_process_bands(analyzer, input, outputs, num_samples);
 }
 
 void spectral_analyzer_reset(spectral_analyzer_t* analyzer) {
     if (!analyzer) return;
 
-    biquad_reset(&analyzer->low_pass);
-    biquad_reset(&analyzer->band_pass);
-    biquad_reset(&analyzer->high_pass);
+    memset(analyzer->s1, 0, sizeof(analyzer->s1));
+    memset(analyzer->s2, 0, sizeof(analyzer->s2));
 }
 
 void spectral_analyzer_set_crossovers(spectral_analyzer_t* analyzer,
                                      float crossover_low,
-                                     float crossover_high) {
+                                     float crossover_high,
+                                     spectral_filter_t filter_type) {
     if (!analyzer || !analyzer->initialized) return;
 
-    analyzer->crossover_low = crossover_low;
-    analyzer->crossover_high = crossover_high;
-
-    // Reconfigure filters
-    biquad_lowpass(&analyzer->low_pass, crossover_low, analyzer->sample_rate);
+    analyzer->filter_type = filter_type;
 
-    float center_freq = sqrtf(crossover_low * crossover_high);
-    float bandwidth = crossover_high - crossover_low;
-    biquad_bandpass(&analyzer->band_pass, center_freq, bandwidth, analyzer->sample_rate);
+    // Respace all crossovers (log) between the new outer edges
+    const uint32_t num_crossovers = analyzer->num_bands - 1;
+    for (uint32_t i = 0; i < num_crossovers; i++) {
+        float t = (num_crossovers > 1) ? (float)i / (float)(num_crossovers - 1) : 0.0f;
+        analyzer->crossovers[i] = crossover_low * powf(crossover_high / crossover_low, t);
+    }
 
-    biquad_highpass(&analyzer->high_pass, crossover_high, analyzer->sample_rate);
+    // Reconfigure filters
+    configure_bank(analyzer);
 }
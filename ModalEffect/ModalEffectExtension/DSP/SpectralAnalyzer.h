@@ -1,9 +1,10 @@
 /**
  * @file SpectralAnalyzer.h
- * @brief 3-band biquad filter bank for spectral analysis
+ * @brief Biquad filter bank for spectral analysis
  *
  * Splits audio signal into 3 frequency bands (Low, Mid, High) using
- * biquad filters for resonator excitation.
+ * biquad filters for resonator excitation. The same bank generalizes to
+ * N bands (up to SPECTRAL_MAX_BANDS) with log-spaced crossovers.
  */
 
 #ifndef SPECTRAL_ANALYZER_H
@@ -26,27 +27,63 @@ typedef enum {
     NUM_BANDS = 3   ///< Total number of bands
 } spectral_band_t;
 
+#define SPECTRAL_MAX_BANDS 16  ///< Max bands of an N-band analyzer
+#define SPECTRAL_LANE_WIDTH 4   ///< Lanes are padded to a multiple of this
+#define SPECTRAL_MAX_STAGES (2 * (SPECTRAL_MAX_BANDS - 1)) ///< Max biquads per band
+
 /**
- * @brief Biquad filter state
+ * @brief Band filter designs
  */
-typedef struct {
-    // Filter coefficients
-    float a0, a1, a2;  ///< Feedback coefficients
-    float b0, b1, b2;  ///< Feedforward coefficients
-
-    // Filter state
-    float x1, x2;  ///< Input history
-    float y1, y2;  ///< Output history
-} biquad_t;
+typedef enum {
+    SPECTRAL_FILTER_BUTTERWORTH = 0,  ///< 2nd-order LP / constant-bandwidth BP / HP (overlapping)
+    SPECTRAL_FILTER_LR4               ///< Linkwitz-Riley 4th-order crossover tree (bands sum to allpass)
+} spectral_filter_t;
 
 /**
- * @brief Spectral analyzer state (3-band filter bank)
+ * @brief Spectral analyzer state (N-band filter bank, SoA)
+ *
+ * Each band is a cascade of biquad stages, stored as structure-of-arrays
+ * lanes (one lane per band) in transposed Direct Form II:
+ *
+ *     y  = b0·x + s1
+ *     s1 = b1·x - a1·y + s2
+ *     s2 = b2·x - a2·y
+ *
+ * All bands see the same input, so each group of SPECTRAL_LANE_WIDTH bands
+ * is one SIMD vector (SSE2, opt-in NEON, scalar fallback) that runs over the whole
+ * buffer with its state in registers. Padding lanes have zero coefficients,
+ * bands with fewer stages are padded with identity stages.
+ *
+ * BUTTERWORTH (1 stage): band 0 is a low-pass at the first crossover, the
+ * last band a high-pass at the last crossover, and each band in between a
+ * band-pass centered (geometrically) between its two crossovers.
+ *
+ * LR4: the crossover tree x → (LP_1, HP_1 → (LP_2, HP_2 → ...)) with
+ * LR4 = two Butterworth (Q = 1/√2) sections, flattened to one cascade per
+ * band. Band b = HP_1..HP_b · LP_(b+1) · AP_(b+2)..AP_(N-1), where AP_j is
+ * the 2nd-order allpass LP_j + HP_j, so the bands sum to an allpass of the
+ * input (flat magnitude, no double excitation around crossovers). Costs
+ * 2(N-1) stages per band; 4 for the 3-band case.
  */
 typedef struct {
     float sample_rate;        ///< Sample rate in Hz
-    biquad_t low_pass;       ///< Low-pass filter for low band
-    biquad_t band_pass;      ///< Band-pass filter for mid band
-    biquad_t high_pass;      ///< High-pass filter for high band
+    uint32_t num_bands;       ///< Number of bands [2..SPECTRAL_MAX_BANDS]
+    uint32_t num_lanes;       ///< num_bands padded to SPECTRAL_LANE_WIDTH
+    uint32_t num_stages;      ///< Biquad stages per band [1..SPECTRAL_MAX_STAGES]
+    spectral_filter_t filter_type; ///< Band filter design
+
+    // Per-stage, per-band biquad coefficients (normalized, a0 = 1)
+    float b0[SPECTRAL_MAX_STAGES][SPECTRAL_MAX_BANDS];
+    float b1[SPECTRAL_MAX_STAGES][SPECTRAL_MAX_BANDS];
+    float b2[SPECTRAL_MAX_STAGES][SPECTRAL_MAX_BANDS];
+    float a1[SPECTRAL_MAX_STAGES][SPECTRAL_MAX_BANDS];
+    float a2[SPECTRAL_MAX_STAGES][SPECTRAL_MAX_BANDS];
+
+    // Per-stage, per-band TDF-II state
+    float s1[SPECTRAL_MAX_STAGES][SPECTRAL_MAX_BANDS];
+    float s2[SPECTRAL_MAX_STAGES][SPECTRAL_MAX_BANDS];
+
+    float crossovers[SPECTRAL_MAX_BANDS - 1]; ///< Band edges (Hz), ascending
     float crossover_low;     ///< Low/mid crossover frequency (Hz)
     float crossover_high;    ///< Mid/high crossover frequency (Hz)
     bool initialized;        ///< Initialization flag
@@ -59,25 +96,47 @@ typedef struct {
  * @param sample_rate Sample rate in Hz
  * @param crossover_low Low/mid crossover frequency (default: 300 Hz)
  * @param crossover_high Mid/high crossover frequency (default: 3000 Hz)
+ *
+ * Uses SPECTRAL_FILTER_BUTTERWORTH.
  */
 void spectral_analyzer_init(spectral_analyzer_t* analyzer,
                            float sample_rate,
                            float crossover_low,
                            float crossover_high);
 
+/**
+ * @brief Initialize an N-band analyzer
+ *
+ * Crossovers are spaced logarithmically from min_freq to max_freq
+ * (num_bands - 1 of them). With 3 bands this matches
+ * spectral_analyzer_init(analyzer, sample_rate, min_freq, max_freq).
+ *
+ * @param analyzer Pointer to analyzer structure
+ * @param sample_rate Sample rate in Hz
+ * @param num_bands Number of bands (clamped to [2, SPECTRAL_MAX_BANDS])
+ * @param min_freq Lowest crossover frequency (Hz)
+ * @param max_freq Highest crossover frequency (Hz)
+ */
+void spectral_analyzer_init_bands(spectral_analyzer_t* analyzer,
+                                  float sample_rate,
+                                  uint32_t num_bands,
+                                  float min_freq,
+                                  float max_freq);
+
 /**
  * @brief Process a single sample through all bands
  *
  * @param analyzer Pointer to analyzer structure
  * @param input Input sample
- * @param band_outputs Output array for 3 bands [low, mid, high]
+ * @param band_outputs Output array, one value per band (NUM_BANDS for the
+ *        3-band analyzer, num_bands in general)
  */
 void spectral_analyzer_process(spectral_analyzer_t* analyzer,
                               float input,
                               float band_outputs[NUM_BANDS]);
 
 /**
- * @brief Process a buffer of samples through all bands
+ * @brief Process a buffer of samples through all bands (3-band analyzer)
  *
  * @param analyzer Pointer to analyzer structure
  * @param input Input buffer
@@ -93,6 +152,19 @@ void spectral_analyzer_process_buffer(spectral_analyzer_t* analyzer,
                                       float* high_output,
                                       uint32_t num_samples);
 
+/**
+ * @brief Process a buffer of samples through all N bands
+ *
+ * @param analyzer Pointer to analyzer structure
+ * @param input Input buffer
+ * @param band_outputs One output buffer per band (num_bands entries)
+ * @param num_samples Number of samples to process
+ */
+void spectral_analyzer_process_bands(spectral_analyzer_t* analyzer,
+                                     const float* input,
+                                     float* const* band_outputs,
+                                     uint32_t num_samples);
+
 /**
  * @brief Reset all filter states
  *
@@ -101,15 +173,20 @@ void spectral_analyzer_process_buffer(spectral_analyzer_t* analyzer,
 void spectral_analyzer_reset(spectral_analyzer_t* analyzer);
 
 /**
- * @brief Update crossover frequencies
+ * @brief Update crossover frequencies and filter design
+ *
+ * For N > 3 bands the crossovers are respaced logarithmically between the
+ * two outer edges. Filter state is cleared.
  *
  * @param analyzer Pointer to analyzer structure
- * @param crossover_low Low/mid crossover frequency (Hz)
- * @param crossover_high Mid/high crossover frequency (Hz)
+ * @param crossover_low Low/mid (lowest) crossover frequency (Hz)
+ * @param crossover_high Mid/high (highest) crossover frequency (Hz)
+ * @param filter_type Band filter design
  */
 void spectral_analyzer_set_crossovers(spectral_analyzer_t* analyzer,
                                      float crossover_low,
-                                     float crossover_high);
+                                     float crossover_high,
+                                     spectral_filter_t filter_type);
 
 #ifdef __cplusplus
 }
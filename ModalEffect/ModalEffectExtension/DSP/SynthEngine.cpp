@@ -9,7 +9,9 @@
 #include "NodeManager.h"
 #include "TopologyEngine.h"
 #include "ModalVoice.h"
+#include "DenormalGuard.h"
 #include <algorithm>
+#include <cmath>
 
 // Parameter IDs for ModalEffect (must match ModalEffectExtensionParameterAddresses.h)
 enum ParamID {
@@ -28,7 +30,10 @@ SynthEngine::SynthEngine(uint32_t maxPolyphony)
     , maxFrames_(0)
     , channels_(2)
     , initialized_(false)
-    , controlRateCounter_(0)
+    , controlRateHz_(CONTROL_RATE_HZ)
+    , interpolateAmplitudes_(false)
+    , controlTickSamples_(1)
+    , samplesUntilTick_(0)
     // ModalEffect parameters (5 total)
     , bodySize_(0.5f)      // Default body size
     , material_(0.5f)       // Default material
@@ -98,6 +103,8 @@ void SynthEngine::prepare(double sampleRate, uint32_t maxFrames, uint32_t channe
     // Initialize node manager
     nodeManager_->initialize(static_cast<float>(sampleRate));
 
+    applyControlRate();
+
     // Apply default characters to all nodes
     for (uint8_t i = 0; i < 5; i++) {
         nodeManager_->setNodeCharacter(i, i);  // Node i gets character i
@@ -113,12 +120,46 @@ void SynthEngine::prepare(double sampleRate, uint32_t maxFrames, uint32_t channe
     initialized_ = true;
 }
 
+void SynthEngine::applyControlRate() {
+    // Control tick: whole samples, dt matched to the real tick length
+    controlTickSamples_ = std::max<uint32_t>(1,
+        static_cast<uint32_t>(std::lround(sampleRate_ / controlRateHz_)));
+    samplesUntilTick_ = 0;
+    nodeManager_->setControlTimestep(static_cast<float>(controlTickSamples_ / sampleRate_),
+                                     controlTickSamples_, interpolateAmplitudes_);
+}
+
+void SynthEngine::setControlRate(double rateHz) {
+    if (rateHz <= 0.0) return;
+
+    controlRateHz_ = rateHz;
+    if (initialized_) {
+        applyControlRate();
+    }
+}
+
+void SynthEngine::setNoteRouting(NoteRoutingMode mode) {
+    noteRouting_ = static_cast<uint8_t>(mode);
+    nodeManager_->setRoutingMode(mode);
+}
+
+NoteRoutingMode SynthEngine::getNoteRouting() const {
+    return nodeManager_->getRoutingMode();
+}
+
+void SynthEngine::setAmplitudeInterpolation(bool enabled) {
+    interpolateAmplitudes_ = enabled;
+    if (initialized_) {
+        applyControlRate();
+    }
+}
+
 void SynthEngine::reset() {
     if (!initialized_) return;
 
     // Release all nodes
     nodeManager_->allNotesOff();
-    controlRateCounter_ = 0;
+    samplesUntilTick_ = 0;
 }
 
 void SynthEngine::render(const EventQueue& events, float* outL, float* outR, uint32_t numFrames) {
@@ -131,6 +172,9 @@ void SynthEngine::render(const EventQueue& events, float* outL, float* outR, uin
         return;
     }
 
+    // Decay tails flush to zero instead of going denormal
+    DenormalGuard denormalGuard;
+
     // Sample-accurate event processing pattern:
     // Process events in order, rendering slices between events
 
@@ -189,15 +233,23 @@ void SynthEngine::processEvent(const SynthEvent& event) {
 }
 
 void SynthEngine::renderSlice(float* outL, float* outR, uint32_t startFrame, uint32_t numFrames) {
-    // Update control-rate parameters periodically
-    controlRateCounter_ += numFrames;
-    if (controlRateCounter_ >= CONTROL_RATE_SAMPLES) {
-        updateControlRate();
-        controlRateCounter_ = 0;
-    }
+    // Split the slice at control tick boundaries so nodes are stepped
+    // exactly once per tick, independent of host buffer size
+    uint32_t offset = 0;
+    while (offset < numFrames) {
+        if (samplesUntilTick_ == 0) {
+            updateControlRate();
+            samplesUntilTick_ = controlTickSamples_;
+        }
+
+        uint32_t frames = std::min(numFrames - offset, samplesUntilTick_);
 
-    // Render nodes
-    nodeManager_->renderAudio(outL, outR, numFrames);
+        // Render nodes
+        nodeManager_->renderAudio(outL + offset, outR + offset, frames);
+
+        offset += frames;
+        samplesUntilTick_ -= frames;
+    }
 
     // Note: Volume control now functions as global damping (circuit energy control)
     // Output level is controlled in the DAW, not here
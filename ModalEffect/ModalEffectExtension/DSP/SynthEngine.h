@@ -18,6 +18,7 @@
 class ModalVoice;
 class NodeManager;
 class TopologyEngine;
+enum class NoteRoutingMode : uint8_t;
 
 /**
  * @brief Event types for sample-accurate processing
@@ -91,6 +92,26 @@ public:
         return true;
     }
 
+    /**
+     * @brief Insert event in sample offset order (real-time safe)
+     *
+     * Goes after queued events with the same or an earlier offset, so
+     * events generated during processing interleave with host events.
+     * @param event Event to add
+     * @return true if added, false if queue full
+     */
+    bool insert(const SynthEvent& event) {
+        if (count_ >= MAX_EVENTS) return false;
+        uint32_t idx = count_;
+        while (idx > 0 && events_[idx - 1].sampleOffset > event.sampleOffset) {
+            events_[idx] = events_[idx - 1];
+            idx--;
+        }
+        events_[idx] = event;
+        count_++;
+        return true;
+    }
+
     /**
      * @brief Get event count
      */
@@ -188,6 +209,38 @@ public:
         return couplingMode_;
     }
 
+    /**
+     * @brief Set how notes are routed to the 5 nodes
+     * @param mode Routing strategy (see NodeManager)
+     */
+    void setNoteRouting(NoteRoutingMode mode);
+
+    /**
+     * @brief Get current note routing
+     */
+    NoteRoutingMode getNoteRouting() const;
+
+    /**
+     * @brief Set the control (modal integration) rate
+     * @param rateHz Ticks per second (default CONTROL_RATE_HZ)
+     *
+     * Lower rates cost proportionally fewer modal steps. Combine with
+     * setAmplitudeInterpolation(true) below ~500 Hz to avoid zipper noise;
+     * with interpolation ~100 Hz is viable.
+     */
+    void setControlRate(double rateHz);
+
+    /**
+     * @brief Get the control rate in Hz
+     */
+    double getControlRate() const { return controlRateHz_; }
+
+    /**
+     * @brief Ramp mode amplitudes linearly across each control tick
+     * @param enabled true = linear tick interpolation, false = one-pole smoothing
+     */
+    void setAmplitudeInterpolation(bool enabled);
+
     /**
      * @brief Get maximum polyphony (always 5 nodes)
      */
@@ -199,6 +252,11 @@ public:
     double getSampleRate() const { return sampleRate_; }
 
 private:
+    /**
+     * @brief Recompute the tick length and push dt/interpolation to the nodes
+     */
+    void applyControlRate();
+
     // DSP components (owned by this class)
     NodeManager* nodeManager_;
     TopologyEngine* topologyEngine_;
@@ -212,9 +270,12 @@ private:
     uint32_t channels_;
     bool initialized_;
 
-    // Control rate state (update at ~200 Hz for better performance)
-    uint32_t controlRateCounter_;
-    static constexpr uint32_t CONTROL_RATE_SAMPLES = 240; // ~200 Hz at 48kHz
+    // Control-rate scheduler: every node is stepped exactly once per tick,
+    // render slices are split at tick boundaries
+    double controlRateHz_;          ///< Control rate (CONTROL_RATE_HZ by default)
+    bool interpolateAmplitudes_;    ///< Linear per-tick amplitude ramps in the synths
+    uint32_t controlTickSamples_;   ///< Tick length in samples (sampleRate / controlRateHz_)
+    uint32_t samplesUntilTick_;     ///< Samples left before the next tick (0 = tick now)
 
     // ModalEffect parameters
     float bodySize_;        // Body size [0, 1]
@@ -237,7 +298,7 @@ private:
     uint8_t node4_character_;
 
     // Parameter cache - Routing
-    uint8_t noteRouting_;      // 0=RoundRobin, 1=PitchZones
+    uint8_t noteRouting_;      // NoteRoutingMode (0=MidiChannel, 2=RoundRobin, 3=PitchZone)
     uint8_t multiExcite_;      // 0=ReTrigger, 1=Accumulate
 
     // Parameter cache - Per-mode parameters (for Character Editor)
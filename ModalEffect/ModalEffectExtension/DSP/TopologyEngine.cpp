@@ -105,7 +105,8 @@ void TopologyEngine::updateCoupling(ModalVoice** voices, uint32_t num_voices) {
         return;
     }
 
-    // Apply coupling for each voice
+    // Apply coupling for each voice. Dormant voices still listen (the input
+    // may wake them) but do not broadcast
     for (uint32_t i = 0; i < num_voices; i++) {
         if (!voices[i]->isActive()) continue;
 
@@ -113,7 +114,7 @@ void TopologyEngine::updateCoupling(ModalVoice** voices, uint32_t num_voices) {
         float coupling_inputs[MAX_MODES] = {0.0f};
 
         for (uint32_t j = 0; j < num_voices; j++) {
-            if (i == j || !voices[j]->isActive()) continue;
+            if (i == j || !voices[j]->isAwake()) continue;
 
             float coupling_weight = coupling_matrix_[i][j];
             // OPTIMIZATION: Skip if coupling weight is negligible
@@ -144,7 +145,7 @@ void TopologyEngine::updateCouplingComplex(ModalVoice** voices, uint32_t num_voi
     }
 
     // Complex diffusive coupling for mode 0 only
-    // Δa_{i,0} = dt * g * Σ_j w_{ij}(a_{j,0} - a_{i,0})
+    // Δa_{i,0} = dt * g * Σ_j w_{ij}(a_{j,0} - a_{i,0}), dormant voices as in updateCoupling()
     for (uint32_t i = 0; i < num_voices; i++) {
         if (!voices[i]->isActive()) continue;
 
@@ -152,7 +153,7 @@ void TopologyEngine::updateCouplingComplex(ModalVoice** voices, uint32_t num_voi
         modal_complex_t coupling0 = modal_complex_t(0.0f, 0.0f);
 
         for (uint32_t j = 0; j < num_voices; j++) {
-            if (i == j || !voices[j]->isActive()) continue;
+            if (i == j || !voices[j]->isAwake()) continue;
 
             float w = coupling_matrix_[i][j];
             if (w < 0.001f) continue;
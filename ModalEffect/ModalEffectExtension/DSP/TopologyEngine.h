@@ -54,6 +54,9 @@ public:
      * @brief Update coupling between voices
      * @param voices Array of voice pointers
      * @param num_voices Number of voices
+     *
+     * Only awake voices act as sources; dormant voices receive coupling,
+     * which wakes them once it lifts them above the silence level.
      */
     void updateCoupling(ModalVoice** voices, uint32_t num_voices);
 
@@ -14,8 +14,7 @@ VoiceAllocator::VoiceAllocator(uint32_t max_polyphony)
     , personality_(PERSONALITY_RESONATOR)
     , poke_strength_(0.5f)
     , poke_duration_ms_(10.0f)
-    , temp_buffer_L_(nullptr)
-    , temp_buffer_R_(nullptr)
+    , temp_buffer_(nullptr)
     , max_buffer_size_(0)
     , sample_rate_(48000.0f)
     , initialized_(false)
@@ -45,14 +44,10 @@ VoiceAllocator::~VoiceAllocator() {
         delete[] voices_;
     }
 
-    // Free temp buffers
-    if (temp_buffer_L_) {
-        delete[] temp_buffer_L_;
-        temp_buffer_L_ = nullptr;
-    }
-    if (temp_buffer_R_) {
-        delete[] temp_buffer_R_;
-        temp_buffer_R_ = nullptr;
+    // Free temp buffer
+    if (temp_buffer_) {
+        delete[] temp_buffer_;
+        temp_buffer_ = nullptr;
     }
 }
 
@@ -67,8 +62,7 @@ void VoiceAllocator::initialize(float sample_rate) {
     // Allocate temp buffers for rendering (real-time safe)
     // Use 2048 samples as maximum - covers most typical audio buffer sizes
     max_buffer_size_ = 2048;
-    temp_buffer_L_ = new float[max_buffer_size_];
-    temp_buffer_R_ = new float[max_buffer_size_];
+    temp_buffer_ = new float[max_buffer_size_];
 
     initialized_ = true;
 }
@@ -252,23 +246,23 @@ void VoiceAllocator::renderAudio(float* outL, float* outR, uint32_t num_frames)
         num_frames = max_buffer_size_;
     }
 
-    // Clear output buffers
+    // Clear output buffer (voices are mono, mixed into L then copied to R)
     memset(outL, 0, num_frames * sizeof(float));
-    memset(outR, 0, num_frames * sizeof(float));
 
-    // Mix all active voices using pre-allocated temp buffers (real-time safe)
+    // Mix all awake voices using pre-allocated temp buffer (real-time safe)
     for (uint32_t i = 0; i < max_polyphony_; i++) {
-        if (voices_[i]->isActive()) {
-            // Render voice into temp buffers
-            voices_[i]->renderAudio(temp_buffer_L_, temp_buffer_R_, num_frames);
+        if (voices_[i]->isAwake()) {
+            // Render voice into temp buffer
+            voices_[i]->renderAudioMono(temp_buffer_, num_frames);
 
             // Mix into output
             for (uint32_t j = 0; j < num_frames; j++) {
-                outL[j] += temp_buffer_L_[j];
-                outR[j] += temp_buffer_R_[j];
+                outL[j] += temp_buffer_[j];
             }
         }
     }
+
+    memcpy(outR, outL, num_frames * sizeof(float));
 }
 
 ModalVoice* VoiceAllocator::getVoice(uint32_t voice_idx) {
@@ -153,8 +153,7 @@ private:
     float poke_duration_ms_;           ///< Poke duration in milliseconds
 
     // Pre-allocated temp buffers for render (real-time safe)
-    float* temp_buffer_L_;             ///< Temp buffer for voice rendering (L channel)
-    float* temp_buffer_R_;             ///< Temp buffer for voice rendering (R channel)
+    float* temp_buffer_;               ///< Temp buffer for voice rendering (mono)
     uint32_t max_buffer_size_;         ///< Maximum buffer size allocated
 
     float sample_rate_;                ///< Current sample rate
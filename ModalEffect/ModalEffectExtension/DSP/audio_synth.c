@@ -7,9 +7,17 @@
  * - Pull-based rendering (AU callback)
  * - Stereo float output (not 4-channel TDM)
  * - No I2S/DMA code
+ *
+ * Two backends:
+ * - PHASE: original per-sample loop (phase accumulator, sinf, shape switch)
+ * - ROTATOR: sine modes advance by one complex multiply per sample
+ *   (z ← z·e^(iΔφ)), all 4 in one SIMD kernel (audio_synth_simd.c); other
+ *   shapes are rendered one mode at a time by band-limited kernels
  */
 
 #include "audio_synth.h"
+#include "audio_synth_simd.h"
+#include "DenormalGuard.h"
 #include <math.h>
 #include <string.h>
 
@@ -23,6 +31,8 @@
 
 #define SMOOTH_ALPHA 0.12f  // Smoothing factor (matches Python SMOOTH)
 #define MAX_AMPLITUDE_SCALE 0.7f  // Headroom (matches Python MAX_AMPLITUDE)
+#define PHASE_TO_RADIANS (2.0f * (float)M_PI / 4294967296.0f)
+#define PHASE_TO_UNIT (1.0f / 4294967296.0f)  // Increment → cycles per sample
 
 // ============================================================================
 // Fast Math Helpers
@@ -70,7 +80,7 @@ static inline float osc_sine(float phase) {
 }
 
 /**
- * @brief Sawtooth oscillator (naive, will alias)
+ * @brief Sawtooth oscillator (naive, will alias - reference backend only)
  * @param phase Phase in radians [0, 2π)
  * @return Sample value [-1, 1]
  */
@@ -80,7 +90,7 @@ static inline float osc_sawtooth(float phase) {
 }
 
 /**
- * @brief Triangle oscillator
+ * @brief Triangle oscillator (naive - reference backend only)
  * @param phase Phase in radians [0, 2π)
  * @return Sample value [-1, 1]
  */
@@ -95,7 +105,7 @@ static inline float osc_triangle(float phase) {
 }
 
 /**
- * @brief Square/pulse oscillator
+ * @brief Square/pulse oscillator (naive, will alias - reference backend only)
  * @param phase Phase in radians [0, 2π)
  * @param pulse_width Pulse width [0, 1], where 0.5 = square
  * @return Sample value [-1, 1]
@@ -105,6 +115,91 @@ static inline float osc_pulse(float phase, float pulse_width) {
     return (phase < threshold) ? 1.0f : -1.0f;
 }
 
+// ============================================================================
+// Band-Limited Corrections (rotator backend)
+// ============================================================================
+
+/*
+ * PolyBLEP / PolyBLAMP: two-sample polynomial residuals added around each
+ * discontinuity (step or slope change) of the naive waveform. t is the
+ * normalized phase [0, 1) measured from the discontinuity, dt the phase
+ * increment per sample. No tables; cost is a compare per sample.
+ */
+
+/**
+ * @brief PolyBLEP residual for a unit-height step at t = 0 (scaled ×2)
+ */
+static inline float poly_blep(float t, float dt) {
+    if (t < dt) {
+        float x = t / dt;
+        return x + x - x * x - 1.0f;
+    } else if (t > 1.0f - dt) {
+        float x = (t - 1.0f) / dt;
+        return x * x + x + x + 1.0f;
+    }
+    return 0.0f;
+}
+
+/**
+ * @brief PolyBLAMP residual for a unit slope change (per sample) at t = 0
+ */
+static inline float poly_blamp(float t, float dt) {
+    if (t < dt) {
+        float x = 1.0f - t / dt;
+        return x * x * x * (1.0f / 6.0f);
+    } else if (t > 1.0f - dt) {
+        float x = 1.0f + (t - 1.0f) / dt;
+        return x * x * x * (1.0f / 6.0f);
+    }
+    return 0.0f;
+}
+
+/**
+ * @brief Phase accumulator → normalized phase [0, 1)
+ *
+ * Uses the top 24 bits so the float conversion is exact and never rounds
+ * up to 1.0.
+ */
+static inline float phase_unit(uint32_t phase_acc) {
+    return (float)(phase_acc >> 8) * (1.0f / 16777216.0f);
+}
+
+/**
+ * @brief Wrap a normalized phase into [0, 1)
+ */
+static inline float wrap_unit(float t) {
+    return t - floorf(t);
+}
+
+/**
+ * @brief Band-limited descending sawtooth (same shape as osc_sawtooth)
+ */
+static inline float osc_sawtooth_bl(float t, float dt) {
+    // Jumps from -1 to +1 at t = 0
+    return 1.0f - 2.0f * t + poly_blep(t, dt);
+}
+
+/**
+ * @brief Band-limited triangle (same shape as osc_triangle)
+ */
+static inline float osc_triangle_bl(float t, float dt) {
+    float naive = (t < 0.5f) ? (-1.0f + 4.0f * t) : (3.0f - 4.0f * t);
+
+    // Slope changes by +8dt per sample at t = 0, by -8dt at t = 0.5
+    float slope_change = 8.0f * dt;
+    return naive + slope_change * (poly_blamp(t, dt) - poly_blamp(wrap_unit(t + 0.5f), dt));
+}
+
+/**
+ * @brief Band-limited pulse (same shape as osc_pulse)
+ */
+static inline float osc_pulse_bl(float t, float dt, float pulse_width) {
+    float naive = (t < pulse_width) ? 1.0f : -1.0f;
+
+    // Rising edge at t = 0, falling edge at t = pulse_width
+    return naive + poly_blep(t, dt) - poly_blep(wrap_unit(t - pulse_width + 1.0f), dt);
+}
+
 // ============================================================================
 // Initialization
 // ============================================================================
@@ -118,12 +213,23 @@ void audio_synth_init(audio_synth_t* synth,
     synth->params.sample_rate = sample_rate;
     synth->params.master_gain = 1.0f;
     synth->params.muted = false;
+    synth->backend = AUDIO_SYNTH_BACKEND_ROTATOR;
+    synth->interp = AUDIO_SYNTH_INTERP_SMOOTH;
+    synth->tick_samples = 1;
+    synth->last_step_count = node ? node->step_count : 0;
+
+    // Resolve the SIMD kernel once, outside the render thread
+    audio_synth_simd_active();
 
     // Initialize per-mode parameters
     for (int k = 0; k < MAX_MODES; k++) {
         synth->params.phase_accumulator[k] = 0;
         synth->params.mode_gains[k] = 1.0f;
         synth->amplitude_smooth[k] = 0.0f;
+
+        synth->osc_re[k] = 1.0f;
+        synth->osc_im[k] = 0.0f;
+        synth->rot_omega[k] = NAN;
     }
 
     synth->initialized = true;
@@ -131,38 +237,45 @@ void audio_synth_init(audio_synth_t* synth,
 
 void audio_synth_set_sample_rate(audio_synth_t* synth, float sample_rate) {
     synth->params.sample_rate = sample_rate;
+
+    // Rotations depend on the sample rate
+    for (int k = 0; k < MAX_MODES; k++) {
+        synth->rot_omega[k] = NAN;
+    }
 }
 
-// ============================================================================
-// Audio Generation
-// ============================================================================
+void audio_synth_set_backend(audio_synth_t* synth, audio_synth_backend_t backend) {
+    synth->backend = backend;
+}
 
-void audio_synth_render(audio_synth_t* synth,
-                       float* outL,
-                       float* outR,
-                       uint32_t num_frames) {
-    if (!synth->initialized || !synth->node) {
-        // Return silence
-        memset(outL, 0, num_frames * sizeof(float));
-        memset(outR, 0, num_frames * sizeof(float));
-        return;
-    }
+void audio_synth_set_interpolation(audio_synth_t* synth,
+                                   audio_synth_interp_t interp,
+                                   uint32_t tick_samples) {
+    synth->interp = interp;
+    synth->tick_samples = (tick_samples > 0) ? tick_samples : 1;
 
-    if (synth->params.muted) {
-        // Muted: return silence
-        memset(outL, 0, num_frames * sizeof(float));
-        memset(outR, 0, num_frames * sizeof(float));
-        return;
+    // Restart from the current amplitudes; the next tick starts a new ramp
+    synth->interp_pos = synth->tick_samples;
+    synth->last_step_count = synth->node->step_count;
+    for (int k = 0; k < MAX_MODES; k++) {
+        synth->amp_target[k] = synth->amplitude_smooth[k];
     }
+}
+
+// ============================================================================
+// Audio Generation
+// ============================================================================
 
+/**
+ * @brief Reference backend (original per-sample loop)
+ */
+static void render_phase_reference(audio_synth_t* synth,
+                                   float* out,
+                                   uint32_t num_frames) {
     const modal_node_t* node = synth->node;
     const float sample_rate = synth->params.sample_rate;
 
-    // Initialize output buffers to zero
-    memset(outL, 0, num_frames * sizeof(float));
-    memset(outR, 0, num_frames * sizeof(float));
-
-    // Generate stereo audio
+    // Generate mono audio
     // Mix all modes together for both channels
     for (uint32_t sample_idx = 0; sample_idx < num_frames; sample_idx++) {
         float sample_sum = 0.0f;
@@ -180,8 +293,8 @@ void audio_synth_render(audio_synth_t* synth,
             amplitude_raw *= node->modes[k].params.weight;
 
             // Smooth amplitude to avoid clicks
-            synth->amplitude_smooth[k] +=
-                SMOOTH_ALPHA * (amplitude_raw - synth->amplitude_smooth[k]);
+            synth->amplitude_smooth[k] = denormal_snap(synth->amplitude_smooth[k] +
+                SMOOTH_ALPHA * (amplitude_raw - synth->amplitude_smooth[k]));
 
             // Final amplitude with gains
             float amplitude = synth->amplitude_smooth[k] *
@@ -249,9 +362,378 @@ void audio_synth_render(audio_synth_t* synth,
         if (sample_sum > 1.0f) sample_sum = 1.0f;
         if (sample_sum < -1.0f) sample_sum = -1.0f;
 
-        // Write to stereo output (mono source, duplicated to L/R)
-        outL[sample_idx] = sample_sum;
-        outR[sample_idx] = sample_sum;
+        out[sample_idx] = sample_sum;
+    }
+}
+
+// ============================================================================
+// Rotator Backend - Block Plan
+// ============================================================================
+
+/**
+ * @brief Per-block render plan (built once per render call)
+ *
+ * The modal state is constant across a render call, so everything that
+ * depends on it is computed here once per mode. The kernels only ramp:
+ *
+ *     amp[i] = min(amp_start + (i + 1)·amp_step, MAX_AMPLITUDE_SCALE)
+ *
+ * amp_start/amp_step already include weight, mode gain and master gain.
+ */
+typedef struct {
+    uint32_t num_frames;
+    float amp_start[MAX_MODES];         ///< Smoothed amplitude × gains at block start
+    float amp_step[MAX_MODES];          ///< Per-sample amplitude increment
+    wave_shape_t shape[MAX_MODES];      ///< Wave shape per mode
+    bool active[MAX_MODES];             ///< Mode renders this block
+} audio_synth_block_t;
+
+/**
+ * @brief Rebuild a mode's per-sample rotation if ω (or the sample rate) changed
+ */
+static inline void update_rotation(audio_synth_t* synth, int k, float omega) {
+    if (omega == synth->rot_omega[k]) return;
+
+    // Same arithmetic as the reference backend so both advance identically
+    float freq_hz = omega / (2.0f * M_PI);
+    float phase_inc = 2.0f * M_PI * freq_hz / synth->params.sample_rate;
+    synth->rot_re[k] = cosf(phase_inc);
+    synth->rot_im[k] = sinf(phase_inc);
+    synth->phase_inc[k] = (uint32_t)(phase_inc * 4294967296.0f / (2.0f * M_PI));
+    synth->rot_omega[k] = omega;
+}
+
+/**
+ * @brief Block-rate pre-pass: targets, ramps and rotations for all modes
+ *
+ * The one-pole smoother is advanced in closed form to the end of the block,
+ * s_n = target + (s_0 - target)·(1 - α)^n, and the kernels ramp linearly
+ * from s_0 to s_n. In LINEAR mode s_n is instead the point reached on the
+ * current tick's ramp after this block.
+ */
+static void prepare_block(audio_synth_t* synth, audio_synth_block_t* block,
+                          uint32_t num_frames) {
+    const modal_node_t* node = synth->node;
+    const float master = synth->params.master_gain * MAX_AMPLITUDE_SCALE;
+    const float decay = powf(1.0f - SMOOTH_ALPHA, (float)num_frames);
+    const float inv_frames = 1.0f / (float)num_frames;
+    const bool linear = (synth->interp == AUDIO_SYNTH_INTERP_LINEAR);
+
+    // LINEAR: a new tick restarts the ramp toward the new |a|
+    bool new_tick = false;
+    if (linear && node->step_count != synth->last_step_count) {
+        synth->last_step_count = node->step_count;
+        synth->interp_pos = 0;
+        new_tick = true;
+    }
+
+    // Samples of this block that still lie inside the tick ramp
+    uint32_t ramp_left = 0;
+    if (linear && synth->interp_pos < synth->tick_samples) {
+        ramp_left = synth->tick_samples - synth->interp_pos;
+    }
+
+    block->num_frames = num_frames;
+
+    for (int k = 0; k < MAX_MODES; k++) {
+        block->active[k] = node->modes[k].params.active;
+        if (!block->active[k]) {
+            continue;
+        }
+
+        // Mode amplitude (|a_k|) with weight
+        float target = cabsf(node->modes[k].a) * node->modes[k].params.weight;
+        float gain = synth->params.mode_gains[k] * master;
+
+        float smooth_start = synth->amplitude_smooth[k];
+        float smooth_end;
+        if (!linear) {
+            smooth_end = target + (smooth_start - target) * decay;
+        } else {
+            if (new_tick) {
+                synth->amp_target[k] = target;
+            }
+            if (ramp_left == 0) {
+                smooth_end = smooth_start;  // Hold until the next tick
+            } else if (ramp_left <= num_frames) {
+                // Ramp ends inside this block; it is rendered as one
+                // segment, so spread the remainder over the whole block
+                smooth_end = synth->amp_target[k];
+            } else {
+                smooth_end = smooth_start + (synth->amp_target[k] - smooth_start) *
+                             ((float)num_frames / (float)ramp_left);
+            }
+        }
+        synth->amplitude_smooth[k] = denormal_snap(smooth_end);
+
+        block->amp_start[k] = smooth_start * gain;
+        block->amp_step[k] = (smooth_end - smooth_start) * gain * inv_frames;
+        block->shape[k] = node->modes[k].params.shape;
+        if (block->shape[k] > WAVE_SHAPE_PULSE_10) {
+            block->shape[k] = WAVE_SHAPE_SINE;  // Fallback to sine
+        }
+
+        update_rotation(synth, k, node->modes[k].params.omega);
+    }
+
+    if (linear) {
+        synth->interp_pos = (ramp_left > num_frames) ? synth->interp_pos + num_frames
+                                                     : synth->tick_samples;
+    }
+}
+
+/**
+ * @brief Ramped amplitude for sample i, clipped to headroom
+ */
+static inline float ramp_amplitude(float amp_start, float amp_step, uint32_t i) {
+    return fminf(amp_start + (float)(i + 1) * amp_step, MAX_AMPLITUDE_SCALE);
+}
+
+// ============================================================================
+// Rotator Backend - Per-Shape Kernels
+// ============================================================================
+
+/**
+ * @brief Load the sine modes of a block into a 4-lane kernel state
+ *
+ * Non-sine and inactive modes are masked (zero ramp, identity rotation) so
+ * their phasors are left untouched.
+ *
+ * @return True if at least one mode is a sounding sine
+ */
+static bool load_sine4(const audio_synth_t* synth, const audio_synth_block_t* block,
+                       audio_synth_sine4_t* sine4) {
+    bool any_sine = false;
+
+    for (int k = 0; k < MAX_MODES; k++) {
+        bool sine = block->active[k] && block->shape[k] == WAVE_SHAPE_SINE;
+        any_sine |= sine;
+
+        sine4->osc_re[k] = synth->osc_re[k];
+        sine4->osc_im[k] = synth->osc_im[k];
+        sine4->rot_re[k] = sine ? synth->rot_re[k] : 1.0f;
+        sine4->rot_im[k] = sine ? synth->rot_im[k] : 0.0f;
+        sine4->amp_start[k] = sine ? block->amp_start[k] : 0.0f;
+        sine4->amp_step[k] = sine ? block->amp_step[k] : 0.0f;
+    }
+    sine4->amp_max = MAX_AMPLITUDE_SCALE;
+
+    return any_sine;
+}
+
+/**
+ * @brief Store rendered sine phasors back (renormalized) and advance phases
+ */
+static void store_sine4(audio_synth_t* synth, const audio_synth_block_t* block,
+                        const audio_synth_sine4_t* sine4) {
+    for (int k = 0; k < MAX_MODES; k++) {
+        if (!block->active[k] || block->shape[k] != WAVE_SHAPE_SINE) continue;
+
+        // Renormalize |z| to 1 once per block (first-order Newton step)
+        float re = sine4->osc_re[k];
+        float im = sine4->osc_im[k];
+        float g = 1.5f - 0.5f * (re * re + im * im);
+        synth->osc_re[k] = re * g;
+        synth->osc_im[k] = im * g;
+
+        synth->params.phase_accumulator[k] += synth->phase_inc[k] * block->num_frames;
+    }
+}
+
+/**
+ * @brief Sine modes: all 4 lanes in one SIMD kernel call
+ */
+static void render_sine_modes(audio_synth_t* synth, const audio_synth_block_t* block,
+                              float* out) {
+    audio_synth_sine4_t sine4;
+    if (!load_sine4(synth, block, &sine4)) return;
+
+    audio_synth_sine4(&sine4, out, block->num_frames);
+    store_sine4(synth, block, &sine4);
+}
+
+/**
+ * @brief Re-seed the rotator from the phase accumulator
+ *
+ * Keeps sine rendering phase-continuous when a mode switches from a
+ * phase-accumulator shape back to sine.
+ */
+static inline void sync_rotator(audio_synth_t* synth, int k) {
+    float phase = synth->params.phase_accumulator[k] * PHASE_TO_RADIANS;
+    synth->osc_re[k] = cosf(phase);
+    synth->osc_im[k] = sinf(phase);
+}
+
+static void kernel_sawtooth(audio_synth_t* synth, const audio_synth_block_t* block,
+                            int k, float* out) {
+    const uint32_t num_frames = block->num_frames;
+    const float amp_start = block->amp_start[k];
+    const float amp_step = block->amp_step[k];
+    uint32_t phase_acc = synth->params.phase_accumulator[k];
+    const uint32_t inc = synth->phase_inc[k];
+    const float dt = inc * PHASE_TO_UNIT;
+
+    for (uint32_t i = 0; i < num_frames; i++) {
+        out[i] += ramp_amplitude(amp_start, amp_step, i) *
+                  osc_sawtooth_bl(phase_unit(phase_acc), dt);
+        phase_acc += inc;
+    }
+
+    synth->params.phase_accumulator[k] = phase_acc;
+    sync_rotator(synth, k);
+}
+
+static void kernel_triangle(audio_synth_t* synth, const audio_synth_block_t* block,
+                            int k, float* out) {
+    const uint32_t num_frames = block->num_frames;
+    const float amp_start = block->amp_start[k];
+    const float amp_step = block->amp_step[k];
+    uint32_t phase_acc = synth->params.phase_accumulator[k];
+    const uint32_t inc = synth->phase_inc[k];
+    const float dt = inc * PHASE_TO_UNIT;
+
+    for (uint32_t i = 0; i < num_frames; i++) {
+        out[i] += ramp_amplitude(amp_start, amp_step, i) *
+                  osc_triangle_bl(phase_unit(phase_acc), dt);
+        phase_acc += inc;
+    }
+
+    synth->params.phase_accumulator[k] = phase_acc;
+    sync_rotator(synth, k);
+}
+
+static void kernel_pulse(audio_synth_t* synth, const audio_synth_block_t* block,
+                         int k, float* out, float pulse_width) {
+    const uint32_t num_frames = block->num_frames;
+    const float amp_start = block->amp_start[k];
+    const float amp_step = block->amp_step[k];
+    uint32_t phase_acc = synth->params.phase_accumulator[k];
+    const uint32_t inc = synth->phase_inc[k];
+    const float dt = inc * PHASE_TO_UNIT;
+
+    for (uint32_t i = 0; i < num_frames; i++) {
+        out[i] += ramp_amplitude(amp_start, amp_step, i) *
+                  osc_pulse_bl(phase_unit(phase_acc), dt, pulse_width);
+        phase_acc += inc;
+    }
+
+    synth->params.phase_accumulator[k] = phase_acc;
+    sync_rotator(synth, k);
+}
+
+/**
+ * @brief Rotator backend: block pre-pass, then shape dispatch once per mode
+ */
+static void render_rotator(audio_synth_t* synth,
+                           float* out,
+                           uint32_t num_frames) {
+    audio_synth_block_t block;
+    prepare_block(synth, &block, num_frames);
+
+    // Modes accumulate into the buffer, then clamp
+    memset(out, 0, num_frames * sizeof(float));
+
+    render_sine_modes(synth, &block, out);
+
+    for (int k = 0; k < MAX_MODES; k++) {
+        if (!block.active[k] || block.shape[k] == WAVE_SHAPE_SINE) {
+            continue;
+        }
+
+        switch (block.shape[k]) {
+            case WAVE_SHAPE_SAWTOOTH:
+                kernel_sawtooth(synth, &block, k, out);
+                break;
+            case WAVE_SHAPE_TRIANGLE:
+                kernel_triangle(synth, &block, k, out);
+                break;
+            case WAVE_SHAPE_SQUARE:
+                kernel_pulse(synth, &block, k, out, 0.5f);
+                break;
+            case WAVE_SHAPE_PULSE_25:
+                kernel_pulse(synth, &block, k, out, 0.25f);
+                break;
+            case WAVE_SHAPE_PULSE_10:
+                kernel_pulse(synth, &block, k, out, 0.1f);
+                break;
+            default:
+                break;
+        }
+    }
+
+    // Clamp to prevent overflow
+    for (uint32_t i = 0; i < num_frames; i++) {
+        out[i] = fminf(fmaxf(out[i], -1.0f), 1.0f);
+    }
+}
+
+void audio_synth_render_mono(audio_synth_t* synth,
+                            float* out,
+                            uint32_t num_frames) {
+    if (!synth->initialized || !synth->node || synth->params.muted) {
+        // Return silence
+        memset(out, 0, num_frames * sizeof(float));
+        return;
+    }
+
+    if (synth->backend == AUDIO_SYNTH_BACKEND_PHASE) {
+        render_phase_reference(synth, out, num_frames);
+    } else {
+        render_rotator(synth, out, num_frames);
+    }
+}
+
+void audio_synth_render(audio_synth_t* synth,
+                       float* outL,
+                       float* outR,
+                       uint32_t num_frames) {
+    // Mono source, duplicated to L/R
+    audio_synth_render_mono(synth, outL, num_frames);
+    memcpy(outR, outL, num_frames * sizeof(float));
+}
+
+// ============================================================================
+// Multi-Node Batch Rendering
+// ============================================================================
+
+bool audio_synth_can_batch(const audio_synth_t* synth) {
+    if (!synth->initialized || !synth->node) return false;
+    if (synth->params.muted) return false;
+    if (synth->backend != AUDIO_SYNTH_BACKEND_ROTATOR) return false;
+
+    for (int k = 0; k < MAX_MODES; k++) {
+        const mode_state_t* mode = &synth->node->modes[k];
+        if (mode->params.active && mode->params.shape != WAVE_SHAPE_SINE &&
+            mode->params.shape <= WAVE_SHAPE_PULSE_10) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void audio_synth_render_batch(audio_synth_t* const* synths,
+                              const float* gains_l,
+                              const float* gains_r,
+                              uint32_t count,
+                              float* outL,
+                              float* outR,
+                              uint32_t num_frames) {
+    audio_synth_block_t blocks[AUDIO_SYNTH_MAX_BATCH];
+    audio_synth_sine4_t states[AUDIO_SYNTH_MAX_BATCH];
+
+    if (count > AUDIO_SYNTH_MAX_BATCH) count = AUDIO_SYNTH_MAX_BATCH;
+
+    for (uint32_t n = 0; n < count; n++) {
+        prepare_block(synths[n], &blocks[n], num_frames);
+        load_sine4(synths[n], &blocks[n], &states[n]);
+        states[n].gain_l = gains_l ? gains_l[n] : 1.0f;
+        states[n].gain_r = gains_r ? gains_r[n] : 1.0f;
+    }
+
+    audio_synth_sine4_batch(states, count, outL, outR, num_frames);
+
+    for (uint32_t n = 0; n < count; n++) {
+        store_sine4(synths[n], &blocks[n], &states[n]);
     }
 }
 
@@ -279,6 +761,8 @@ void audio_synth_set_mute(audio_synth_t* synth, bool mute) {
 void audio_synth_reset_phase(audio_synth_t* synth) {
     for (int k = 0; k < MAX_MODES; k++) {
         synth->params.phase_accumulator[k] = 0;
+        synth->osc_re[k] = 1.0f;
+        synth->osc_im[k] = 0.0f;
         // Also reset amplitude smoothing to prevent clicks
         synth->amplitude_smooth[k] = 0.0f;
     }
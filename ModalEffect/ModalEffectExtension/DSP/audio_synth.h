@@ -30,11 +30,28 @@ extern "C" {
 #define AUDIO_BUFFER_SAMPLES 512  // Typical AU buffer size
 #define NUM_AUDIO_CHANNELS 2      // Stereo output for AU
 #define BITS_PER_SAMPLE 32        // Float samples for AU
+#define AUDIO_SYNTH_MAX_BATCH 16  // Max synths per audio_synth_render_batch() call
 
 // ============================================================================
 // Type Definitions
 // ============================================================================
 
+/**
+ * @brief Rendering backends
+ */
+typedef enum {
+    AUDIO_SYNTH_BACKEND_PHASE = 0,  ///< Reference: phase accumulator, sinf() + shape switch per sample
+    AUDIO_SYNTH_BACKEND_ROTATOR     ///< Complex rotator sines, per-shape kernels (default)
+} audio_synth_backend_t;
+
+/**
+ * @brief Amplitude interpolation between control ticks (rotator backend)
+ */
+typedef enum {
+    AUDIO_SYNTH_INTERP_SMOOTH = 0,  ///< One-pole SMOOTH_ALPHA per sample toward |a| (default)
+    AUDIO_SYNTH_INTERP_LINEAR       ///< Linear ramp to each new tick's |a| over one tick
+} audio_synth_interp_t;
+
 /**
  * @brief Audio synthesis parameters
  */
@@ -53,6 +70,23 @@ typedef struct {
     audio_synth_params_t params;
     const modal_node_t* node;           ///< Reference to modal node state
     float amplitude_smooth[MAX_MODES];  ///< Smoothed amplitudes per mode
+    audio_synth_backend_t backend;      ///< Rendering backend
+
+    // Control-tick interpolation (AUDIO_SYNTH_INTERP_LINEAR)
+    audio_synth_interp_t interp;        ///< Amplitude interpolation mode
+    uint32_t tick_samples;              ///< Samples per control tick
+    uint32_t interp_pos;                ///< Samples rendered since the last tick
+    uint32_t last_step_count;           ///< node->step_count of the current ramp
+    float amp_target[MAX_MODES];        ///< Ramp end (|a|·weight at the last tick)
+
+    // Rotator oscillator state (sine modes), z = e^(iφ)
+    float osc_re[MAX_MODES];            ///< Re(z) = cos φ
+    float osc_im[MAX_MODES];            ///< Im(z) = sin φ
+    float rot_re[MAX_MODES];            ///< cos(Δφ) per sample
+    float rot_im[MAX_MODES];            ///< sin(Δφ) per sample
+    uint32_t phase_inc[MAX_MODES];      ///< Phase accumulator increment per sample
+    float rot_omega[MAX_MODES];         ///< ω the rotation was built for (NAN = invalid)
+
     bool initialized;
 } audio_synth_t;
 
@@ -87,6 +121,20 @@ void audio_synth_render(audio_synth_t* synth,
                        float* outR,
                        uint32_t num_frames);
 
+/**
+ * @brief Generate audio samples (mono float)
+ *
+ * Same as audio_synth_render() but writes the mono signal once, for
+ * callers that mix or pan it themselves.
+ *
+ * @param synth Pointer to synthesis state
+ * @param out Output buffer
+ * @param num_frames Number of frames to generate
+ */
+void audio_synth_render_mono(audio_synth_t* synth,
+                            float* out,
+                            uint32_t num_frames);
+
 /**
  * @brief Set sample rate (for sample rate changes)
  *
@@ -95,6 +143,67 @@ void audio_synth_render(audio_synth_t* synth,
  */
 void audio_synth_set_sample_rate(audio_synth_t* synth, float sample_rate);
 
+/**
+ * @brief Select rendering backend
+ *
+ * @param synth Pointer to synthesis state
+ * @param backend Backend to use for subsequent render calls
+ */
+void audio_synth_set_backend(audio_synth_t* synth, audio_synth_backend_t backend);
+
+/**
+ * @brief Select how amplitudes move between control ticks
+ *
+ * SMOOTH follows |a| with a per-sample one-pole, so its envelope depends on
+ * the sample rate and zipper noise only drops by raising the control rate.
+ * LINEAR detects each new modal_node_step() and ramps every mode from its
+ * current amplitude to the new |a| across exactly tick_samples samples
+ * (one tick of latency), independent of the render buffer size. That keeps
+ * envelopes smooth at control rates down to ~100 Hz. Only the rotator
+ * backend interpolates; the reference backend always uses SMOOTH.
+ *
+ * @param synth Pointer to synthesis state
+ * @param interp Interpolation mode
+ * @param tick_samples Samples per control tick (LINEAR only, >= 1)
+ */
+void audio_synth_set_interpolation(audio_synth_t* synth,
+                                   audio_synth_interp_t interp,
+                                   uint32_t tick_samples);
+
+/**
+ * @brief Check whether a synth can be rendered by audio_synth_render_batch()
+ *
+ * True for an initialized, unmuted rotator-backend synth whose active modes
+ * are all sines.
+ *
+ * @param synth Pointer to synthesis state
+ */
+bool audio_synth_can_batch(const audio_synth_t* synth);
+
+/**
+ * @brief Render several synths and accumulate them into the output
+ *
+ * Equivalent to calling audio_synth_render_mono() on each synth, scaling
+ * it by its gains and summing, but the sine modes of 2-4 synths share one
+ * wide SIMD kernel and no per-synth buffers are written. Every synth must
+ * pass audio_synth_can_batch().
+ *
+ * @param synths Synths to render (at most AUDIO_SYNTH_MAX_BATCH)
+ * @param gains_l Per-synth gain into outL (NULL = 1)
+ * @param gains_r Per-synth gain into outR (NULL = 1, ignored if outR is NULL)
+ * @param count Number of synths
+ * @param outL Left (or mono) output buffer (accumulated, not overwritten)
+ * @param outR Right output buffer (accumulated), or NULL for mono
+ * @param num_frames Number of frames to generate
+ */
+void audio_synth_render_batch(audio_synth_t* const* synths,
+                              const float* gains_l,
+                              const float* gains_r,
+                              uint32_t count,
+                              float* outL,
+                              float* outR,
+                              uint32_t num_frames);
+
 /**
  * @brief Set per-mode gain
  *
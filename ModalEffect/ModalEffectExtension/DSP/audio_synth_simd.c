@@ -0,0 +1,654 @@
+/**
+ * @file audio_synth_simd.c
+ * @brief SIMD sine kernels for audio_synth
+ *
+ * Every implementation computes, per sample i and lane k:
+ *
+ *     amp_k = min(amp_start_k + (i + 1)·amp_step_k, amp_max)
+ *     out[i] += Σ_k amp_k · Im(z_k)
+ *     z_k ← z_k · e^(iΔφ_k)
+ *
+ * The vector kernels produce one vector of 4 mode contributions per sample
+ * and reduce 4 samples at a time with a transpose (or pairwise adds), so the
+ * output is written with one vector load/add/store per 4 samples.
+ *
+ * SSE2 and NEON use separate multiply and add, so they match the scalar
+ * kernel up to the order of the 4-lane sum. AVX2 uses FMA and a doubled
+ * rotation for the odd-sample half, so it is close but not bit-exact.
+ *
+ * The batch kernels put one node per 128-bit lane group and transpose
+ * within each group, so 4 samples of every node are reduced at once and
+ * clamped per node before the groups are summed into the output.
+ */
+
+#include "audio_synth_simd.h"
+#include <math.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+#define AUDIO_SYNTH_HAVE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(AUDIO_SYNTH_HAVE_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#define AUDIO_SYNTH_HAVE_AVX2 1
+#include <immintrin.h>
+#endif
+
+#if defined(AUDIO_SYNTH_HAVE_AVX2) && !defined(__APPLE__)
+#define AUDIO_SYNTH_HAVE_AVX512 1
+#endif
+
+// The NEON kernel has not been built and run on hardware yet: opt in with
+// AUDIO_SYNTH_ENABLE_NEON (CMake: MODAL_EFFECT_ENABLE_NEON) and run
+// audio_synth_simd_test before relying on it. AArch64 uses scalar otherwise.
+#if defined(__aarch64__) && defined(AUDIO_SYNTH_ENABLE_NEON)
+#define AUDIO_SYNTH_HAVE_NEON 1
+#include <arm_neon.h>
+#endif
+
+// ============================================================================
+// Scalar
+// ============================================================================
+
+void audio_synth_sine4_scalar(audio_synth_sine4_t* state, float* out, uint32_t num_frames) {
+    float re[MAX_MODES], im[MAX_MODES];
+    for (int k = 0; k < MAX_MODES; k++) {
+        re[k] = state->osc_re[k];
+        im[k] = state->osc_im[k];
+    }
+
+    for (uint32_t i = 0; i < num_frames; i++) {
+        const float idx = (float)(i + 1);
+        float sum = 0.0f;
+
+        for (int k = 0; k < MAX_MODES; k++) {
+            float amplitude = fminf(state->amp_start[k] + idx * state->amp_step[k],
+                                    state->amp_max);
+            sum += amplitude * im[k];
+
+            // z ← z·e^(iΔφ)
+            float next_re = re[k] * state->rot_re[k] - im[k] * state->rot_im[k];
+            im[k] = re[k] * state->rot_im[k] + im[k] * state->rot_re[k];
+            re[k] = next_re;
+        }
+
+        out[i] += sum;
+    }
+
+    for (int k = 0; k < MAX_MODES; k++) {
+        state->osc_re[k] = re[k];
+        state->osc_im[k] = im[k];
+    }
+}
+
+// ============================================================================
+// SSE2
+// ============================================================================
+
+#ifdef AUDIO_SYNTH_HAVE_SSE2
+
+static inline float hsum_sse(__m128 v) {
+    __m128 shuf = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+    __m128 sums = _mm_add_ps(v, shuf);
+    shuf = _mm_movehl_ps(shuf, sums);
+    return _mm_cvtss_f32(_mm_add_ss(sums, shuf));
+}
+
+static void sine4_sse2(audio_synth_sine4_t* state, float* out, uint32_t num_frames) {
+    __m128 re = _mm_loadu_ps(state->osc_re);
+    __m128 im = _mm_loadu_ps(state->osc_im);
+    const __m128 c = _mm_loadu_ps(state->rot_re);
+    const __m128 s = _mm_loadu_ps(state->rot_im);
+    const __m128 start = _mm_loadu_ps(state->amp_start);
+    const __m128 step = _mm_loadu_ps(state->amp_step);
+    const __m128 amp_max = _mm_set1_ps(state->amp_max);
+    const __m128 one = _mm_set1_ps(1.0f);
+    __m128 idx = one;
+
+    uint32_t i = 0;
+    for (; i + 4 <= num_frames; i += 4) {
+        __m128 v[4];
+
+        for (int j = 0; j < 4; j++) {
+            __m128 amplitude = _mm_min_ps(_mm_add_ps(start, _mm_mul_ps(idx, step)), amp_max);
+            v[j] = _mm_mul_ps(amplitude, im);
+
+            __m128 next_re = _mm_sub_ps(_mm_mul_ps(re, c), _mm_mul_ps(im, s));
+            im = _mm_add_ps(_mm_mul_ps(re, s), _mm_mul_ps(im, c));
+            re = next_re;
+            idx = _mm_add_ps(idx, one);
+        }
+
+        // Columns → rows: row j holds sample i + j's mode contributions
+        _MM_TRANSPOSE4_PS(v[0], v[1], v[2], v[3]);
+        __m128 sum = _mm_add_ps(_mm_add_ps(v[0], v[1]), _mm_add_ps(v[2], v[3]));
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(out + i), sum));
+    }
+
+    for (; i < num_frames; i++) {
+        __m128 amplitude = _mm_min_ps(_mm_add_ps(start, _mm_mul_ps(idx, step)), amp_max);
+        out[i] += hsum_sse(_mm_mul_ps(amplitude, im));
+
+        __m128 next_re = _mm_sub_ps(_mm_mul_ps(re, c), _mm_mul_ps(im, s));
+        im = _mm_add_ps(_mm_mul_ps(re, s), _mm_mul_ps(im, c));
+        re = next_re;
+        idx = _mm_add_ps(idx, one);
+    }
+
+    _mm_storeu_ps(state->osc_re, re);
+    _mm_storeu_ps(state->osc_im, im);
+}
+
+#endif // AUDIO_SYNTH_HAVE_SSE2
+
+// ============================================================================
+// AVX2 + FMA
+// ============================================================================
+
+#ifdef AUDIO_SYNTH_HAVE_AVX2
+
+/*
+ * Two samples per 256-bit vector: the low half holds z at even samples,
+ * the high half z at odd samples, and both advance by e^(2iΔφ).
+ */
+__attribute__((target("avx2,fma")))
+static void sine4_avx2(audio_synth_sine4_t* state, float* out, uint32_t num_frames) {
+    const __m128 re0 = _mm_loadu_ps(state->osc_re);
+    const __m128 im0 = _mm_loadu_ps(state->osc_im);
+    const __m128 c = _mm_loadu_ps(state->rot_re);
+    const __m128 s = _mm_loadu_ps(state->rot_im);
+
+    // z at the odd sample, and the double-step rotation
+    const __m128 re1 = _mm_sub_ps(_mm_mul_ps(re0, c), _mm_mul_ps(im0, s));
+    const __m128 im1 = _mm_add_ps(_mm_mul_ps(re0, s), _mm_mul_ps(im0, c));
+    const __m128 c2 = _mm_sub_ps(_mm_mul_ps(c, c), _mm_mul_ps(s, s));
+    const __m128 s2 = _mm_mul_ps(_mm_set1_ps(2.0f), _mm_mul_ps(c, s));
+
+    __m256 re = _mm256_insertf128_ps(_mm256_castps128_ps256(re0), re1, 1);
+    __m256 im = _mm256_insertf128_ps(_mm256_castps128_ps256(im0), im1, 1);
+    const __m256 cc = _mm256_insertf128_ps(_mm256_castps128_ps256(c2), c2, 1);
+    const __m256 ss = _mm256_insertf128_ps(_mm256_castps128_ps256(s2), s2, 1);
+
+    const __m256 start = _mm256_broadcast_ps((const __m128*)state->amp_start);
+    const __m256 step = _mm256_broadcast_ps((const __m128*)state->amp_step);
+    const __m256 amp_max = _mm256_set1_ps(state->amp_max);
+    const __m256 two = _mm256_set1_ps(2.0f);
+    __m256 idx = _mm256_setr_ps(1.0f, 1.0f, 1.0f, 1.0f, 2.0f, 2.0f, 2.0f, 2.0f);
+
+    uint32_t i = 0;
+    for (; i + 8 <= num_frames; i += 8) {
+        __m256 v[4];
+
+        for (int j = 0; j < 4; j++) {
+            __m256 amplitude = _mm256_min_ps(_mm256_fmadd_ps(idx, step, start), amp_max);
+            v[j] = _mm256_mul_ps(amplitude, im);
+
+            __m256 next_re = _mm256_fmsub_ps(re, cc, _mm256_mul_ps(im, ss));
+            im = _mm256_fmadd_ps(re, ss, _mm256_mul_ps(im, cc));
+            re = next_re;
+            idx = _mm256_add_ps(idx, two);
+        }
+
+        // Per 128-bit half: [Σv0, Σv1, Σv2, Σv3] → even samples low, odd high
+        __m256 h01 = _mm256_hadd_ps(v[0], v[1]);
+        __m256 h23 = _mm256_hadd_ps(v[2], v[3]);
+        __m256 h = _mm256_hadd_ps(h01, h23);
+        __m128 even = _mm256_castps256_ps128(h);
+        __m128 odd = _mm256_extractf128_ps(h, 1);
+
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(out + i), _mm_unpacklo_ps(even, odd)));
+        _mm_storeu_ps(out + i + 4, _mm_add_ps(_mm_loadu_ps(out + i + 4), _mm_unpackhi_ps(even, odd)));
+    }
+
+    // Tail: continue single-step from the even-sample half
+    __m128 re_t = _mm256_castps256_ps128(re);
+    __m128 im_t = _mm256_castps256_ps128(im);
+    const __m128 start_t = _mm256_castps256_ps128(start);
+    const __m128 step_t = _mm256_castps256_ps128(step);
+    const __m128 max_t = _mm256_castps256_ps128(amp_max);
+
+    for (; i < num_frames; i++) {
+        __m128 amplitude = _mm_min_ps(_mm_fmadd_ps(_mm_set1_ps((float)(i + 1)), step_t, start_t),
+                                      max_t);
+        out[i] += hsum_sse(_mm_mul_ps(amplitude, im_t));
+
+        __m128 next_re = _mm_fmsub_ps(re_t, c, _mm_mul_ps(im_t, s));
+        im_t = _mm_fmadd_ps(re_t, s, _mm_mul_ps(im_t, c));
+        re_t = next_re;
+    }
+
+    _mm_storeu_ps(state->osc_re, re_t);
+    _mm_storeu_ps(state->osc_im, im_t);
+}
+
+#endif // AUDIO_SYNTH_HAVE_AVX2
+
+// ============================================================================
+// NEON
+// ============================================================================
+
+#ifdef AUDIO_SYNTH_HAVE_NEON
+
+static void sine4_neon(audio_synth_sine4_t* state, float* out, uint32_t num_frames) {
+    float32x4_t re = vld1q_f32(state->osc_re);
+    float32x4_t im = vld1q_f32(state->osc_im);
+    const float32x4_t c = vld1q_f32(state->rot_re);
+    const float32x4_t s = vld1q_f32(state->rot_im);
+    const float32x4_t start = vld1q_f32(state->amp_start);
+    const float32x4_t step = vld1q_f32(state->amp_step);
+    const float32x4_t amp_max = vdupq_n_f32(state->amp_max);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    float32x4_t idx = one;
+
+    uint32_t i = 0;
+    for (; i + 4 <= num_frames; i += 4) {
+        float32x4_t v[4];
+
+        for (int j = 0; j < 4; j++) {
+            float32x4_t amplitude = vminq_f32(vaddq_f32(start, vmulq_f32(idx, step)), amp_max);
+            v[j] = vmulq_f32(amplitude, im);
+
+            float32x4_t next_re = vsubq_f32(vmulq_f32(re, c), vmulq_f32(im, s));
+            im = vaddq_f32(vmulq_f32(re, s), vmulq_f32(im, c));
+            re = next_re;
+            idx = vaddq_f32(idx, one);
+        }
+
+        // Pairwise adds: [Σv0, Σv1, Σv2, Σv3]
+        float32x4_t sum = vpaddq_f32(vpaddq_f32(v[0], v[1]), vpaddq_f32(v[2], v[3]));
+        vst1q_f32(out + i, vaddq_f32(vld1q_f32(out + i), sum));
+    }
+
+    for (; i < num_frames; i++) {
+        float32x4_t amplitude = vminq_f32(vaddq_f32(start, vmulq_f32(idx, step)), amp_max);
+        out[i] += vaddvq_f32(vmulq_f32(amplitude, im));
+
+        float32x4_t next_re = vsubq_f32(vmulq_f32(re, c), vmulq_f32(im, s));
+        im = vaddq_f32(vmulq_f32(re, s), vmulq_f32(im, c));
+        re = next_re;
+        idx = vaddq_f32(idx, one);
+    }
+
+    vst1q_f32(state->osc_re, re);
+    vst1q_f32(state->osc_im, im);
+}
+
+#endif // AUDIO_SYNTH_HAVE_NEON
+
+// ============================================================================
+// Multi-Node Batch
+// ============================================================================
+
+#define BATCH_CHUNK_FRAMES 64
+
+static inline float clamp_unit(float x) {
+    return fminf(fmaxf(x, -1.0f), 1.0f);
+}
+
+/**
+ * @brief One node through the single-node kernel, clamped, in stack chunks
+ */
+static void batch1(audio_synth_sine4_t* state, float* outL, float* outR, uint32_t num_frames) {
+    float chunk[BATCH_CHUNK_FRAMES];
+    audio_synth_sine4_t part = *state;
+
+    for (uint32_t offset = 0; offset < num_frames; offset += BATCH_CHUNK_FRAMES) {
+        uint32_t n = num_frames - offset;
+        if (n > BATCH_CHUNK_FRAMES) n = BATCH_CHUNK_FRAMES;
+
+        // Continue the ramp where the previous chunk stopped
+        for (int k = 0; k < MAX_MODES; k++) {
+            part.amp_start[k] = state->amp_start[k] + (float)offset * state->amp_step[k];
+        }
+
+        memset(chunk, 0, n * sizeof(float));
+        audio_synth_sine4(&part, chunk, n);
+
+        for (uint32_t i = 0; i < n; i++) {
+            float sample = clamp_unit(chunk[i]);
+            outL[offset + i] += state->gain_l * sample;
+            if (outR) outR[offset + i] += state->gain_r * sample;
+        }
+    }
+
+    memcpy(state->osc_re, part.osc_re, sizeof(part.osc_re));
+    memcpy(state->osc_im, part.osc_im, sizeof(part.osc_im));
+}
+
+#ifdef AUDIO_SYNTH_HAVE_AVX2
+
+__attribute__((target("avx2,fma")))
+static inline __m256 load_pair(const float* a, const float* b) {
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(a)), _mm_loadu_ps(b), 1);
+}
+
+__attribute__((target("avx2,fma")))
+static inline __m256 set_pair(float a, float b) {
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(a)), _mm_set1_ps(b), 1);
+}
+
+__attribute__((target("avx2,fma")))
+static inline __m128 sum_halves(__m256 v) {
+    return _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+}
+
+/**
+ * @brief Two nodes per 256-bit vector (low half = states[0], high = states[1])
+ */
+__attribute__((target("avx2,fma")))
+static void batch2_avx2(audio_synth_sine4_t* states, float* outL, float* outR,
+                        uint32_t num_frames) {
+    __m256 re = load_pair(states[0].osc_re, states[1].osc_re);
+    __m256 im = load_pair(states[0].osc_im, states[1].osc_im);
+    const __m256 c = load_pair(states[0].rot_re, states[1].rot_re);
+    const __m256 s = load_pair(states[0].rot_im, states[1].rot_im);
+    const __m256 start = load_pair(states[0].amp_start, states[1].amp_start);
+    const __m256 step = load_pair(states[0].amp_step, states[1].amp_step);
+    const __m256 amp_max = set_pair(states[0].amp_max, states[1].amp_max);
+    const __m256 gain_l = set_pair(states[0].gain_l, states[1].gain_l);
+    const __m256 gain_r = set_pair(states[0].gain_r, states[1].gain_r);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 minus_one = _mm256_set1_ps(-1.0f);
+    __m256 idx = one;
+
+    uint32_t i = 0;
+    for (; i + 4 <= num_frames; i += 4) {
+        __m256 v[4];
+
+        for (int j = 0; j < 4; j++) {
+            __m256 amplitude = _mm256_min_ps(_mm256_fmadd_ps(idx, step, start), amp_max);
+            v[j] = _mm256_mul_ps(amplitude, im);
+
+            __m256 next_re = _mm256_fmsub_ps(re, c, _mm256_mul_ps(im, s));
+            im = _mm256_fmadd_ps(re, s, _mm256_mul_ps(im, c));
+            re = next_re;
+            idx = _mm256_add_ps(idx, one);
+        }
+
+        // Transpose within each 128-bit half: row m = mode m of samples 0..3
+        __m256 t0 = _mm256_unpacklo_ps(v[0], v[1]);
+        __m256 t1 = _mm256_unpacklo_ps(v[2], v[3]);
+        __m256 t2 = _mm256_unpackhi_ps(v[0], v[1]);
+        __m256 t3 = _mm256_unpackhi_ps(v[2], v[3]);
+        __m256 sum = _mm256_add_ps(
+            _mm256_add_ps(_mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0)),
+                          _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2))),
+            _mm256_add_ps(_mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0)),
+                          _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2))));
+
+        // Per-node clamp, then mix both nodes with their gains
+        sum = _mm256_min_ps(_mm256_max_ps(sum, minus_one), one);
+        __m128 mix_l = sum_halves(_mm256_mul_ps(sum, gain_l));
+        _mm_storeu_ps(outL + i, _mm_add_ps(_mm_loadu_ps(outL + i), mix_l));
+
+        if (outR) {
+            __m128 mix_r = sum_halves(_mm256_mul_ps(sum, gain_r));
+            _mm_storeu_ps(outR + i, _mm_add_ps(_mm_loadu_ps(outR + i), mix_r));
+        }
+    }
+
+    for (; i < num_frames; i++) {
+        __m256 amplitude = _mm256_min_ps(_mm256_fmadd_ps(idx, step, start), amp_max);
+        __m256 v = _mm256_mul_ps(amplitude, im);
+        float node0 = clamp_unit(hsum_sse(_mm256_castps256_ps128(v)));
+        float node1 = clamp_unit(hsum_sse(_mm256_extractf128_ps(v, 1)));
+
+        outL[i] += states[0].gain_l * node0 + states[1].gain_l * node1;
+        if (outR) outR[i] += states[0].gain_r * node0 + states[1].gain_r * node1;
+
+        __m256 next_re = _mm256_fmsub_ps(re, c, _mm256_mul_ps(im, s));
+        im = _mm256_fmadd_ps(re, s, _mm256_mul_ps(im, c));
+        re = next_re;
+        idx = _mm256_add_ps(idx, one);
+    }
+
+    _mm_storeu_ps(states[0].osc_re, _mm256_castps256_ps128(re));
+    _mm_storeu_ps(states[1].osc_re, _mm256_extractf128_ps(re, 1));
+    _mm_storeu_ps(states[0].osc_im, _mm256_castps256_ps128(im));
+    _mm_storeu_ps(states[1].osc_im, _mm256_extractf128_ps(im, 1));
+}
+
+#endif // AUDIO_SYNTH_HAVE_AVX2
+
+#ifdef AUDIO_SYNTH_HAVE_AVX512
+
+#define LOAD_QUAD(field) load_quad(states[0].field, states[1].field, states[2].field, states[3].field)
+#define SET_QUAD(field) set_quad(states[0].field, states[1].field, states[2].field, states[3].field)
+
+__attribute__((target("avx512f")))
+static inline __m512 load_quad(const float* a, const float* b, const float* c, const float* d) {
+    __m512 v = _mm512_castps128_ps512(_mm_loadu_ps(a));
+    v = _mm512_insertf32x4(v, _mm_loadu_ps(b), 1);
+    v = _mm512_insertf32x4(v, _mm_loadu_ps(c), 2);
+    return _mm512_insertf32x4(v, _mm_loadu_ps(d), 3);
+}
+
+__attribute__((target("avx512f")))
+static inline __m512 set_quad(float a, float b, float c, float d) {
+    __m512 v = _mm512_castps128_ps512(_mm_set1_ps(a));
+    v = _mm512_insertf32x4(v, _mm_set1_ps(b), 1);
+    v = _mm512_insertf32x4(v, _mm_set1_ps(c), 2);
+    return _mm512_insertf32x4(v, _mm_set1_ps(d), 3);
+}
+
+__attribute__((target("avx512f")))
+static inline __m128 sum_quarters(__m512 v) {
+    return _mm_add_ps(_mm_add_ps(_mm512_castps512_ps128(v), _mm512_extractf32x4_ps(v, 1)),
+                      _mm_add_ps(_mm512_extractf32x4_ps(v, 2), _mm512_extractf32x4_ps(v, 3)));
+}
+
+/**
+ * @brief Four nodes per 512-bit vector (128-bit group g = states[g])
+ */
+__attribute__((target("avx512f")))
+static void batch4_avx512(audio_synth_sine4_t* states, float* outL, float* outR,
+                          uint32_t num_frames) {
+    __m512 re = LOAD_QUAD(osc_re);
+    __m512 im = LOAD_QUAD(osc_im);
+    const __m512 c = LOAD_QUAD(rot_re);
+    const __m512 s = LOAD_QUAD(rot_im);
+    const __m512 start = LOAD_QUAD(amp_start);
+    const __m512 step = LOAD_QUAD(amp_step);
+    const __m512 amp_max = SET_QUAD(amp_max);
+    const __m512 gain_l = SET_QUAD(gain_l);
+    const __m512 gain_r = SET_QUAD(gain_r);
+    const __m512 one = _mm512_set1_ps(1.0f);
+    const __m512 minus_one = _mm512_set1_ps(-1.0f);
+    __m512 idx = one;
+
+    uint32_t i = 0;
+    for (; i + 4 <= num_frames; i += 4) {
+        __m512 v[4];
+
+        for (int j = 0; j < 4; j++) {
+            __m512 amplitude = _mm512_min_ps(_mm512_fmadd_ps(idx, step, start), amp_max);
+            v[j] = _mm512_mul_ps(amplitude, im);
+
+            __m512 next_re = _mm512_fmsub_ps(re, c, _mm512_mul_ps(im, s));
+            im = _mm512_fmadd_ps(re, s, _mm512_mul_ps(im, c));
+            re = next_re;
+            idx = _mm512_add_ps(idx, one);
+        }
+
+        // Transpose within each 128-bit group: row m = mode m of samples 0..3
+        __m512 t0 = _mm512_unpacklo_ps(v[0], v[1]);
+        __m512 t1 = _mm512_unpacklo_ps(v[2], v[3]);
+        __m512 t2 = _mm512_unpackhi_ps(v[0], v[1]);
+        __m512 t3 = _mm512_unpackhi_ps(v[2], v[3]);
+        __m512 sum = _mm512_add_ps(
+            _mm512_add_ps(_mm512_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0)),
+                          _mm512_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2))),
+            _mm512_add_ps(_mm512_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0)),
+                          _mm512_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2))));
+
+        // Per-node clamp, then mix all four nodes with their gains
+        sum = _mm512_min_ps(_mm512_max_ps(sum, minus_one), one);
+        __m128 mix_l = sum_quarters(_mm512_mul_ps(sum, gain_l));
+        _mm_storeu_ps(outL + i, _mm_add_ps(_mm_loadu_ps(outL + i), mix_l));
+
+        if (outR) {
+            __m128 mix_r = sum_quarters(_mm512_mul_ps(sum, gain_r));
+            _mm_storeu_ps(outR + i, _mm_add_ps(_mm_loadu_ps(outR + i), mix_r));
+        }
+    }
+
+    for (; i < num_frames; i++) {
+        __m512 amplitude = _mm512_min_ps(_mm512_fmadd_ps(idx, step, start), amp_max);
+        __m512 v = _mm512_mul_ps(amplitude, im);
+        float node[4] = {
+            clamp_unit(hsum_sse(_mm512_castps512_ps128(v))),
+            clamp_unit(hsum_sse(_mm512_extractf32x4_ps(v, 1))),
+            clamp_unit(hsum_sse(_mm512_extractf32x4_ps(v, 2))),
+            clamp_unit(hsum_sse(_mm512_extractf32x4_ps(v, 3)))
+        };
+
+        for (int g = 0; g < 4; g++) {
+            outL[i] += states[g].gain_l * node[g];
+            if (outR) outR[i] += states[g].gain_r * node[g];
+        }
+
+        __m512 next_re = _mm512_fmsub_ps(re, c, _mm512_mul_ps(im, s));
+        im = _mm512_fmadd_ps(re, s, _mm512_mul_ps(im, c));
+        re = next_re;
+        idx = _mm512_add_ps(idx, one);
+    }
+
+    float lanes_re[16], lanes_im[16];
+    _mm512_storeu_ps(lanes_re, re);
+    _mm512_storeu_ps(lanes_im, im);
+    for (int g = 0; g < 4; g++) {
+        memcpy(states[g].osc_re, lanes_re + g * 4, 4 * sizeof(float));
+        memcpy(states[g].osc_im, lanes_im + g * 4, 4 * sizeof(float));
+    }
+}
+
+#endif // AUDIO_SYNTH_HAVE_AVX512
+
+// ============================================================================
+// Runtime Selection
+// ============================================================================
+
+typedef void (*sine4_fn)(audio_synth_sine4_t*, float*, uint32_t);
+
+static sine4_fn active_fn = NULL;
+static audio_synth_simd_t active_level = AUDIO_SYNTH_SIMD_SCALAR;
+
+static bool simd_supported(audio_synth_simd_t level) {
+    switch (level) {
+        case AUDIO_SYNTH_SIMD_SCALAR:
+            return true;
+#ifdef AUDIO_SYNTH_HAVE_SSE2
+        case AUDIO_SYNTH_SIMD_SSE2:
+            return true;
+#endif
+#ifdef AUDIO_SYNTH_HAVE_AVX2
+        case AUDIO_SYNTH_SIMD_AVX2:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+#ifdef AUDIO_SYNTH_HAVE_NEON
+        case AUDIO_SYNTH_SIMD_NEON:
+            return true;
+#endif
+#ifdef AUDIO_SYNTH_HAVE_AVX512
+        case AUDIO_SYNTH_SIMD_AVX512:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx512f") &&
+                   __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+        default:
+            return false;
+    }
+}
+
+audio_synth_simd_t audio_synth_simd_detect(void) {
+    if (simd_supported(AUDIO_SYNTH_SIMD_AVX512)) return AUDIO_SYNTH_SIMD_AVX512;
+    if (simd_supported(AUDIO_SYNTH_SIMD_AVX2)) return AUDIO_SYNTH_SIMD_AVX2;
+    if (simd_supported(AUDIO_SYNTH_SIMD_NEON)) return AUDIO_SYNTH_SIMD_NEON;
+    if (simd_supported(AUDIO_SYNTH_SIMD_SSE2)) return AUDIO_SYNTH_SIMD_SSE2;
+    return AUDIO_SYNTH_SIMD_SCALAR;
+}
+
+audio_synth_simd_t audio_synth_simd_select(audio_synth_simd_t level) {
+    if (!simd_supported(level)) {
+        level = audio_synth_simd_detect();
+    }
+
+    switch (level) {
+#ifdef AUDIO_SYNTH_HAVE_SSE2
+        case AUDIO_SYNTH_SIMD_SSE2:
+            active_fn = sine4_sse2;
+            break;
+#endif
+#ifdef AUDIO_SYNTH_HAVE_AVX2
+        case AUDIO_SYNTH_SIMD_AVX2:
+        case AUDIO_SYNTH_SIMD_AVX512:
+            active_fn = sine4_avx2;
+            break;
+#endif
+#ifdef AUDIO_SYNTH_HAVE_NEON
+        case AUDIO_SYNTH_SIMD_NEON:
+            active_fn = sine4_neon;
+            break;
+#endif
+        default:
+            level = AUDIO_SYNTH_SIMD_SCALAR;
+            active_fn = audio_synth_sine4_scalar;
+            break;
+    }
+
+    active_level = level;
+    return level;
+}
+
+audio_synth_simd_t audio_synth_simd_active(void) {
+    if (!active_fn) {
+        audio_synth_simd_select(audio_synth_simd_detect());
+    }
+    return active_level;
+}
+
+const char* audio_synth_simd_name(audio_synth_simd_t level) {
+    switch (level) {
+        case AUDIO_SYNTH_SIMD_SSE2: return "SSE2";
+        case AUDIO_SYNTH_SIMD_AVX2: return "AVX2+FMA";
+        case AUDIO_SYNTH_SIMD_NEON: return "NEON";
+        case AUDIO_SYNTH_SIMD_AVX512: return "AVX-512F";
+        case AUDIO_SYNTH_SIMD_SCALAR:
+        default: return "scalar";
+    }
+}
+
+void audio_synth_sine4(audio_synth_sine4_t* state, float* out, uint32_t num_frames) {
+    if (!active_fn) {
+        audio_synth_simd_select(audio_synth_simd_detect());
+    }
+    active_fn(state, out, num_frames);
+}
+
+void audio_synth_sine4_batch(audio_synth_sine4_t* states, uint32_t count,
+                             float* outL, float* outR, uint32_t num_frames) {
+    const audio_synth_simd_t level = audio_synth_simd_active();
+    uint32_t n = 0;
+
+#ifdef AUDIO_SYNTH_HAVE_AVX512
+    if (level == AUDIO_SYNTH_SIMD_AVX512) {
+        for (; n + 4 <= count; n += 4) {
+            batch4_avx512(states + n, outL, outR, num_frames);
+        }
+    }
+#endif
+
+#ifdef AUDIO_SYNTH_HAVE_AVX2
+    if (level == AUDIO_SYNTH_SIMD_AVX2 || level == AUDIO_SYNTH_SIMD_AVX512) {
+        for (; n + 2 <= count; n += 2) {
+            batch2_avx2(states + n, outL, outR, num_frames);
+        }
+    }
+#endif
+
+    for (; n < count; n++) {
+        batch1(states + n, outL, outR, num_frames);
+    }
+}
@@ -0,0 +1,132 @@
+/**
+ * @file audio_synth_simd.h
+ * @brief SIMD sine kernels for audio_synth (all 4 modes of a node at once)
+ *
+ * MAX_MODES is 4, so the rotator state of every mode of a node fits one
+ * 128-bit vector: lane k holds mode k's phasor z_k, rotation e^(iΔφ_k) and
+ * amplitude ramp. Each sample is one complex multiply on the whole vector;
+ * modes that should not sound are masked by a zero amplitude ramp and an
+ * identity rotation instead of branching.
+ *
+ * Implementations:
+ * - SSE2 (x86-64 baseline)
+ * - AVX2 + FMA (two samples per 256-bit vector, selected at runtime)
+ * - NEON (AArch64, opt-in with AUDIO_SYNTH_ENABLE_NEON: untested on
+ *   hardware so far, AArch64 builds use scalar until it is verified)
+ * - Scalar fallback (also the reference; Tests/audio_synth_simd_test.c
+ *   checks every available level against it)
+ *
+ * The batch kernel renders several nodes at once: 2 nodes per 256-bit
+ * vector (AVX2) or 4 nodes per 512-bit vector (AVX-512F), one lane per
+ * mode. Each node's sum is clamped separately, then scaled by its output
+ * gains (pan) into one or two output buffers.
+ */
+
+#ifndef AUDIO_SYNTH_SIMD_H
+#define AUDIO_SYNTH_SIMD_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "modal_node.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Type Definitions
+// ============================================================================
+
+/**
+ * @brief SIMD implementation levels
+ */
+typedef enum {
+    AUDIO_SYNTH_SIMD_SCALAR = 0,
+    AUDIO_SYNTH_SIMD_SSE2,
+    AUDIO_SYNTH_SIMD_AVX2,
+    AUDIO_SYNTH_SIMD_NEON,
+    AUDIO_SYNTH_SIMD_AVX512                 ///< AVX2 single-node kernel + 4-node batch
+} audio_synth_simd_t;
+
+/**
+ * @brief 4-mode sine kernel state (one lane per mode)
+ *
+ * Amplitude of lane k at sample i: min(amp_start[k] + (i + 1)·amp_step[k], amp_max)
+ */
+typedef struct {
+    float osc_re[MAX_MODES];            ///< Re(z), updated in place
+    float osc_im[MAX_MODES];            ///< Im(z), updated in place
+    float rot_re[MAX_MODES];            ///< cos(Δφ) (1 for masked lanes)
+    float rot_im[MAX_MODES];            ///< sin(Δφ) (0 for masked lanes)
+    float amp_start[MAX_MODES];         ///< Ramp start (0 for masked lanes)
+    float amp_step[MAX_MODES];          ///< Ramp increment (0 for masked lanes)
+    float amp_max;                      ///< Headroom clip
+    float gain_l;                       ///< Output gain into L/mono (batch only)
+    float gain_r;                       ///< Output gain into R (batch only)
+} audio_synth_sine4_t;
+
+// ============================================================================
+// API
+// ============================================================================
+
+/**
+ * @brief Best implementation supported by the running CPU
+ */
+audio_synth_simd_t audio_synth_simd_detect(void);
+
+/**
+ * @brief Select the implementation used by audio_synth_sine4()
+ *
+ * Falls back to the detected level if the requested one is not supported.
+ * Called once by audio_synth_init() with the detected level; tools may call
+ * it again to compare implementations.
+ *
+ * @return Level actually selected
+ */
+audio_synth_simd_t audio_synth_simd_select(audio_synth_simd_t level);
+
+/**
+ * @brief Currently selected implementation
+ */
+audio_synth_simd_t audio_synth_simd_active(void);
+
+/**
+ * @brief Human-readable implementation name
+ */
+const char* audio_synth_simd_name(audio_synth_simd_t level);
+
+/**
+ * @brief Render 4 rotator sines and accumulate their sum into out
+ *
+ * @param state Kernel state (phasors advanced in place, not renormalized)
+ * @param out Output buffer (accumulated, not overwritten)
+ * @param num_frames Number of frames
+ */
+void audio_synth_sine4(audio_synth_sine4_t* state, float* out, uint32_t num_frames);
+
+/**
+ * @brief Render several nodes' sine modes and accumulate into the output
+ *
+ * outL[i] += Σ_n gain_l_n · clamp(Σ_k amp_nk · Im(z_nk), -1, 1), and the
+ * same into outR with gain_r_n, i.e. the same per-node clamp as
+ * audio_synth_render(), without per-node buffers.
+ *
+ * @param states Kernel states, one per node (phasors advanced in place)
+ * @param count Number of nodes
+ * @param outL Left (or mono) output buffer (accumulated, not overwritten)
+ * @param outR Right output buffer (accumulated), or NULL for mono
+ * @param num_frames Number of frames
+ */
+void audio_synth_sine4_batch(audio_synth_sine4_t* states, uint32_t count,
+                             float* outL, float* outR, uint32_t num_frames);
+
+/**
+ * @brief Scalar implementation (reference for verification)
+ */
+void audio_synth_sine4_scalar(audio_synth_sine4_t* state, float* out, uint32_t num_frames);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AUDIO_SYNTH_SIMD_H
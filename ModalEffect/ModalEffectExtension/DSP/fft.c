@@ -0,0 +1,134 @@
+/**
+ * @file fft.c
+ * @brief Radix-2 complex FFT implementation
+ */
+
+#include "fft.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+uint32_t fft_next_pow2(uint32_t n) {
+    uint32_t size = 1;
+    while (size < n) {
+        size <<= 1;
+    }
+    return size;
+}
+
+// Shared butterfly passes; the inverse uses conjugate twiddles (im_sign = -1)
+static void transform(const fft_t* fft, float* re, float* im, float im_sign) {
+    const uint32_t n = fft->size;
+
+    // Bit-reversal permutation
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t j = fft->bitrev[i];
+        if (j > i) {
+            float t = re[i]; re[i] = re[j]; re[j] = t;
+            t = im[i]; im[i] = im[j]; im[j] = t;
+        }
+    }
+
+    // Butterflies: span doubles each pass; each pass reads its own
+    // contiguous twiddle run at [half - 1, 2·half - 1)
+    for (uint32_t half = 1; half < n; half <<= 1) {
+        const float* w_re = fft->twiddle_re + half - 1;
+        const float* w_im = fft->twiddle_im + half - 1;
+
+        for (uint32_t start = 0; start < n; start += half << 1) {
+            float* restrict top_re = re + start;
+            float* restrict top_im = im + start;
+            float* restrict bottom_re = top_re + half;
+            float* restrict bottom_im = top_im + half;
+
+            for (uint32_t k = 0; k < half; k++) {
+                const float wi = im_sign * w_im[k];
+                const float t_re = bottom_re[k] * w_re[k] - bottom_im[k] * wi;
+                const float t_im = bottom_re[k] * wi + bottom_im[k] * w_re[k];
+
+                bottom_re[k] = top_re[k] - t_re;
+                bottom_im[k] = top_im[k] - t_im;
+                top_re[k] += t_re;
+                top_im[k] += t_im;
+            }
+        }
+    }
+}
+
+// ============================================================================
+// API
+// ============================================================================
+
+bool fft_init(fft_t* fft, uint32_t size) {
+    if (!fft) return false;
+
+    memset(fft, 0, sizeof(*fft));
+
+    if (size < 2) size = 2;
+    size = fft_next_pow2(size);
+
+    fft->size = size;
+    while ((1u << fft->log2_size) < size) {
+        fft->log2_size++;
+    }
+
+    fft->twiddle_re = (float*)malloc((size - 1) * sizeof(float));
+    fft->twiddle_im = (float*)malloc((size - 1) * sizeof(float));
+    fft->bitrev = (uint32_t*)malloc(size * sizeof(uint32_t));
+
+    if (!fft->twiddle_re || !fft->twiddle_im || !fft->bitrev) {
+        fft_cleanup(fft);
+        return false;
+    }
+
+    // Pass with span 2·half uses e^(-πi·k/half), k < half
+    for (uint32_t half = 1; half < size; half <<= 1) {
+        for (uint32_t k = 0; k < half; k++) {
+            double phase = M_PI * (double)k / (double)half;
+            fft->twiddle_re[half - 1 + k] = (float)cos(phase);
+            fft->twiddle_im[half - 1 + k] = (float)-sin(phase);
+        }
+    }
+
+    for (uint32_t i = 0; i < size; i++) {
+        uint32_t rev = 0;
+        for (uint32_t b = 0; b < fft->log2_size; b++) {
+            rev |= ((i >> b) & 1u) << (fft->log2_size - 1 - b);
+        }
+        fft->bitrev[i] = rev;
+    }
+
+    fft->initialized = true;
+    return true;
+}
+
+void fft_forward(const fft_t* fft, float* re, float* im) {
+    if (!fft || !fft->initialized || !re || !im) return;
+    transform(fft, re, im, 1.0f);
+}
+
+void fft_inverse(const fft_t* fft, float* re, float* im) {
+    if (!fft || !fft->initialized || !re || !im) return;
+    transform(fft, re, im, -1.0f);
+}
+
+void fft_cleanup(fft_t* fft) {
+    if (!fft) return;
+
+    free(fft->twiddle_re);
+    free(fft->twiddle_im);
+    free(fft->bitrev);
+
+    fft->twiddle_re = NULL;
+    fft->twiddle_im = NULL;
+    fft->bitrev = NULL;
+    fft->initialized = false;
+}
@@ -0,0 +1,89 @@
+/**
+ * @file fft.h
+ * @brief Radix-2 complex FFT (split real/imaginary arrays)
+ *
+ * Iterative decimation-in-time FFT with the bit-reversal permutation and
+ * twiddle factors precomputed at init, so a transform allocates nothing and
+ * is safe to run on the audio thread. Used by the pitch detector for
+ * O(N log N) correlation instead of per-lag dot products.
+ *
+ * Conventions:
+ *
+ *     forward:  X[k] = Σ_n x[n] · e^(-2πi·kn/N)
+ *     inverse:  x[n] = Σ_k X[k] · e^(+2πi·kn/N)     (unscaled, divide by N)
+ */
+
+#ifndef FFT_H
+#define FFT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Type Definitions
+// ============================================================================
+
+/**
+ * @brief FFT plan (size, twiddles and bit-reversal table)
+ */
+typedef struct {
+    uint32_t size;              ///< Transform size N (power of 2)
+    uint32_t log2_size;         ///< log2(N)
+    float* twiddle_re;          ///< Per-pass cos(πk/half), N - 1 entries
+    float* twiddle_im;          ///< Per-pass -sin(πk/half), N - 1 entries
+    uint32_t* bitrev;           ///< Bit-reversed index of each n < N
+    bool initialized;           ///< Initialization flag
+} fft_t;
+
+// ============================================================================
+// API
+// ============================================================================
+
+/**
+ * @brief Smallest power of 2 >= n
+ */
+uint32_t fft_next_pow2(uint32_t n);
+
+/**
+ * @brief Initialize an FFT plan
+ *
+ * @param fft Pointer to plan structure
+ * @param size Transform size (rounded up to a power of 2, minimum 2)
+ * @return True on success (false if allocation failed)
+ */
+bool fft_init(fft_t* fft, uint32_t size);
+
+/**
+ * @brief In-place forward transform
+ *
+ * @param fft Initialized plan
+ * @param re Real parts (size elements)
+ * @param im Imaginary parts (size elements)
+ */
+void fft_forward(const fft_t* fft, float* re, float* im);
+
+/**
+ * @brief In-place inverse transform (unscaled)
+ *
+ * @param fft Initialized plan
+ * @param re Real parts (size elements)
+ * @param im Imaginary parts (size elements)
+ */
+void fft_inverse(const fft_t* fft, float* re, float* im);
+
+/**
+ * @brief Free plan tables
+ *
+ * @param fft Pointer to plan structure
+ */
+void fft_cleanup(fft_t* fft);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FFT_H
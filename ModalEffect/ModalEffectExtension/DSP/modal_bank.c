@@ -0,0 +1,193 @@
+/**
+ * @file modal_bank.c
+ * @brief Structure-of-arrays modal bank implementation
+ *
+ * One step is split into three passes:
+ * 1. Gather   - per node: excitation envelope, cached propagators, a → lanes
+ * 2. Integrate - per lane: a = a·P + u (branch-free, auto-vectorizable)
+ * 3. Scatter  - per node: lanes → a, step counter
+ *
+ * Dynamics are identical to modal_node_step().
+ */
+
+#include "modal_bank.h"
+#include "DenormalGuard.h"
+#include <math.h>
+#include <string.h>
+
+// ============================================================================
+// Constants
+// ============================================================================
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+/**
+ * @brief Make a lane an identity lane (P = 1, u = 0)
+ */
+static inline void lane_set_identity(modal_bank_t* bank, uint32_t lane) {
+    bank->decay_re[lane] = 1.0f;
+    bank->decay_im[lane] = 0.0f;
+    bank->drive_re[lane] = 0.0f;
+    bank->drive_im[lane] = 0.0f;
+    bank->active[lane] = 0.0f;
+}
+
+/**
+ * @brief Gather one node into its lanes and build this step's propagators
+ */
+static void gather_node(modal_bank_t* bank, uint32_t node_idx) {
+    modal_node_t* node = bank->nodes[node_idx];
+    const uint32_t base = node_idx * MAX_MODES;
+    const float dt = node->dt;
+
+    // Rebuild the node's propagators only if its parameters changed
+    modal_node_update_propagators(node);
+
+    // Envelope integrated over this step, shared by all modes of the node
+    const bool exciting = node->excitation.active;
+    const float envelope_integral = modal_node_advance_excitation(node);
+
+    const bool self_oscillator = (node->personality == PERSONALITY_SELF_OSCILLATOR);
+
+    for (uint32_t k = 0; k < MAX_MODES; k++) {
+        const uint32_t lane = base + k;
+        mode_state_t* mode = &node->modes[k];
+
+        if (!mode->params.active) {
+            lane_set_identity(bank, lane);
+            continue;
+        }
+
+        float re = crealf(mode->a);
+        float im = cimagf(mode->a);
+
+        bank->re[lane] = re;
+        bank->im[lane] = im;
+        bank->active[lane] = 1.0f;
+
+        float p_re = crealf(mode->propagator);
+        float p_im = cimagf(mode->propagator);
+
+        if (self_oscillator) {
+            // Van der Pol-like amplitude-dependent term: exp(-3γ|a|²dt)
+            float saturation = 3.0f * mode->params.gamma * (re * re + im * im);
+            float mag = expf(-saturation * dt);
+            p_re *= mag;
+            p_im *= mag;
+        }
+
+        bank->decay_re[lane] = p_re;
+        bank->decay_im[lane] = p_im;
+
+        // Excitation term (if envelope active during this step)
+        if (exciting) {
+            float phase = node->excitation.phase_hint;
+            if (phase < 0.0f) {
+                phase = random_phase();
+            }
+
+            float strength = node->excitation.strength * mode->params.weight * envelope_integral;
+            bank->drive_re[lane] = strength * cosf(phase);
+            bank->drive_im[lane] = strength * sinf(phase);
+        } else {
+            bank->drive_re[lane] = 0.0f;
+            bank->drive_im[lane] = 0.0f;
+        }
+
+        // Continuous input accumulated by modal_node_drive(), consumed here
+        bank->drive_re[lane] += crealf(mode->drive);
+        bank->drive_im[lane] += cimagf(mode->drive);
+        mode->drive = 0.0f;
+    }
+}
+
+/**
+ * @brief Scatter lanes back into the node
+ */
+static void scatter_node(modal_bank_t* bank, uint32_t node_idx) {
+    modal_node_t* node = bank->nodes[node_idx];
+    const uint32_t base = node_idx * MAX_MODES;
+
+    for (uint32_t k = 0; k < MAX_MODES; k++) {
+        const uint32_t lane = base + k;
+        if (bank->active[lane] == 0.0f) continue;
+
+        node->modes[k].a = denormal_snap(bank->re[lane]) + I * denormal_snap(bank->im[lane]);
+    }
+
+    node->step_count++;
+}
+
+// ============================================================================
+// Modal Bank Core
+// ============================================================================
+
+void modal_bank_init(modal_bank_t* bank, uint32_t num_nodes) {
+    memset(bank, 0, sizeof(modal_bank_t));
+
+    if (num_nodes > MODAL_BANK_MAX_NODES) num_nodes = MODAL_BANK_MAX_NODES;
+
+    bank->num_nodes = num_nodes;
+    bank->num_lanes = num_nodes * MAX_MODES;
+
+    for (uint32_t lane = 0; lane < MODAL_BANK_MAX_LANES; lane++) {
+        lane_set_identity(bank, lane);
+    }
+}
+
+void modal_bank_bind_node(modal_bank_t* bank, uint32_t node_idx, modal_node_t* node) {
+    if (node_idx >= bank->num_nodes) return;
+
+    bank->nodes[node_idx] = node;
+}
+
+void modal_bank_step(modal_bank_t* bank, uint32_t node_mask) {
+    const uint32_t num_lanes = bank->num_lanes;
+
+    // 1. Gather selected, running nodes; everything else becomes identity lanes
+    uint32_t stepped_mask = 0;
+    for (uint32_t n = 0; n < bank->num_nodes; n++) {
+        modal_node_t* node = bank->nodes[n];
+        bool selected = (node_mask >> n) & 1u;
+
+        if (!selected || !node || !node->running) {
+            for (uint32_t k = 0; k < MAX_MODES; k++) {
+                lane_set_identity(bank, n * MAX_MODES + k);
+            }
+            continue;
+        }
+
+        gather_node(bank, n);
+        stepped_mask |= 1u << n;
+    }
+
+    if (stepped_mask == 0) return;
+
+    // 2. Integrate all lanes in one pass: a = a·P + u
+    float* restrict re = bank->re;
+    float* restrict im = bank->im;
+    const float* restrict dr = bank->decay_re;
+    const float* restrict di = bank->decay_im;
+    const float* restrict ur = bank->drive_re;
+    const float* restrict ui = bank->drive_im;
+
+    for (uint32_t lane = 0; lane < num_lanes; lane++) {
+        float a_re = re[lane];
+        float a_im = im[lane];
+        re[lane] = a_re * dr[lane] - a_im * di[lane] + ur[lane];
+        im[lane] = a_re * di[lane] + a_im * dr[lane] + ui[lane];
+    }
+
+    // 3. Scatter back into the node structs
+    for (uint32_t n = 0; n < bank->num_nodes; n++) {
+        if ((stepped_mask >> n) & 1u) {
+            scatter_node(bank, n);
+        }
+    }
+}
@@ -0,0 +1,100 @@
+/**
+ * @file modal_bank.h
+ * @brief Structure-of-arrays modal bank (steps a whole node network at once)
+ *
+ * modal_node_step() walks the interleaved mode_state_t array of one node at
+ * a time. The modal bank instead keeps every mode of every bound node in
+ * contiguous lane arrays (lane = node_idx * MAX_MODES + mode_idx) and
+ * advances the complete network in a single branch-free pass:
+ *
+ *     a[l] ← a[l] · P[l] + u[l]
+ *
+ * where P[l] = exp((-γ + iω)·dt) is the per-lane propagator and u[l] the
+ * excitation drive for this step (poke envelope plus any input accumulated
+ * by modal_node_drive()). Inactive lanes carry P = 1, u = 0.
+ *
+ * The bound modal_node_t structs stay the public view of the state (audio
+ * synthesis, coupling and pokes keep reading/writing them); the bank gathers
+ * their complex amplitudes before the pass and scatters them back after it.
+ * Propagators come from each node's cache (modal_node_update_propagators()),
+ * so they are only rebuilt when ω, γ, global damping or personality change.
+ */
+
+#ifndef MODAL_BANK_H
+#define MODAL_BANK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "modal_node.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Constants
+// ============================================================================
+
+#define MODAL_BANK_MAX_NODES 16
+#define MODAL_BANK_MAX_LANES (MODAL_BANK_MAX_NODES * MAX_MODES)
+
+// ============================================================================
+// Type Definitions
+// ============================================================================
+
+/**
+ * @brief Modal bank state (SoA lanes for all modes of all nodes)
+ */
+typedef struct {
+    uint32_t num_nodes;                           ///< Number of node slots in use
+    uint32_t num_lanes;                           ///< num_nodes * MAX_MODES
+
+    modal_node_t* nodes[MODAL_BANK_MAX_NODES];    ///< Bound nodes (NULL = empty slot)
+
+    // Lane state
+    float re[MODAL_BANK_MAX_LANES];               ///< Re(a)
+    float im[MODAL_BANK_MAX_LANES];               ///< Im(a)
+    float decay_re[MODAL_BANK_MAX_LANES];         ///< Re(P) for this step
+    float decay_im[MODAL_BANK_MAX_LANES];         ///< Im(P) for this step
+    float drive_re[MODAL_BANK_MAX_LANES];         ///< Re(u) for this step
+    float drive_im[MODAL_BANK_MAX_LANES];         ///< Im(u) for this step
+    float active[MODAL_BANK_MAX_LANES];           ///< Active mask (1.0 / 0.0)
+} modal_bank_t;
+
+// ============================================================================
+// Core API
+// ============================================================================
+
+/**
+ * @brief Initialize an empty bank
+ *
+ * @param bank Pointer to bank structure
+ * @param num_nodes Number of node slots [1..MODAL_BANK_MAX_NODES]
+ */
+void modal_bank_init(modal_bank_t* bank, uint32_t num_nodes);
+
+/**
+ * @brief Bind a node to a bank slot
+ *
+ * @param bank Pointer to bank structure
+ * @param node_idx Slot index [0..num_nodes-1]
+ * @param node Node to bind (NULL unbinds the slot)
+ */
+void modal_bank_bind_node(modal_bank_t* bank, uint32_t node_idx, modal_node_t* node);
+
+/**
+ * @brief Advance all selected nodes by one timestep
+ *
+ * Equivalent to calling modal_node_step() on every selected, running node,
+ * but the integration itself runs as one vectorizable pass over all lanes.
+ *
+ * @param bank Pointer to bank structure
+ * @param node_mask Bitmask of slots to step (bit i = slot i)
+ */
+void modal_bank_step(modal_bank_t* bank, uint32_t node_mask);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MODAL_BANK_H
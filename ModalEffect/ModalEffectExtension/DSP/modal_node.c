@@ -9,6 +9,7 @@
  */
 
 #include "modal_node.h"
+#include "DenormalGuard.h"
 #include <math.h>
 #include <string.h>
 #include <stdlib.h>
@@ -99,7 +100,9 @@ void modal_node_init(modal_node_t* node, uint8_t node_id, node_personality_t per
     node->carrier_freq_hz = 440.0f;
     node->audio_gain = 0.7f;
     node->running = false;
+    node->dt = CONTROL_DT;
     node->step_count = 0;
+    node->propagators_dirty = true;
 }
 
 void modal_node_set_mode(modal_node_t* node, uint8_t mode_idx,
@@ -112,6 +115,29 @@ void modal_node_set_mode(modal_node_t* node, uint8_t mode_idx,
     mode->params.weight = weight;
     mode->params.active = true;
     // Note: shape is not set here - preserves existing shape or uses default from init
+
+    node->propagators_dirty = true;
+}
+
+void modal_node_set_global_damping(modal_node_t* node, float damping) {
+    if (node->global_damping == damping) return;
+
+    node->global_damping = damping;
+    node->propagators_dirty = true;
+}
+
+void modal_node_set_personality(modal_node_t* node, node_personality_t personality) {
+    if (node->personality == personality) return;
+
+    node->personality = personality;
+    node->propagators_dirty = true;
+}
+
+void modal_node_set_dt(modal_node_t* node, float dt) {
+    if (dt <= 0.0f || node->dt == dt) return;
+
+    node->dt = dt;
+    node->propagators_dirty = true;
 }
 
 void modal_node_set_neighbors(modal_node_t* node,
@@ -121,18 +147,72 @@ void modal_node_set_neighbors(modal_node_t* node,
     memcpy(node->neighbor_ids, neighbor_ids, node->num_neighbors);
 }
 
-void modal_node_step(modal_node_t* node) {
-    if (!node->running) return;
+void modal_node_update_propagators(modal_node_t* node) {
+    if (!node->propagators_dirty) return;
 
-    // Update excitation envelope if active
-    if (node->excitation.active) {
-        node->excitation.elapsed_ms += CONTROL_DT * 1000.0f;
+    for (int k = 0; k < MAX_MODES; k++) {
+        mode_state_t* mode = &node->modes[k];
+        float omega = mode->params.omega;
+        float gamma = mode->params.gamma;
+
+        // Linear part of the damping: self-oscillators start from -γ and get
+        // their amplitude-dependent +3γ|a|² term applied per step
+        float linear_gamma = (node->personality == PERSONALITY_SELF_OSCILLATOR) ? -gamma : gamma;
+        linear_gamma += node->global_damping;
 
-        if (node->excitation.elapsed_ms >= node->excitation.duration_ms) {
-            node->excitation.active = false;
+        float complex lambda = -linear_gamma + I * omega;
+        mode->propagator = cexpf(lambda * node->dt);
+
+        // Per-sample propagator for modal_node_drive()
+        if (node->drive_rate > 0.0f) {
+            mode->drive_propagator = cexpf(lambda / node->drive_rate);
         }
     }
 
+    node->propagators_dirty = false;
+}
+
+/**
+ * @brief Antiderivative of the Hann envelope 0.5(1 - cos(πt/D)), t in ms
+ */
+static inline float hann_integral_ms(float t_ms, float duration_ms) {
+    return 0.5f * (t_ms - duration_ms / M_PI * sinf(M_PI * t_ms / duration_ms));
+}
+
+float modal_node_advance_excitation(modal_node_t* node) {
+    excitation_envelope_t* exc = &node->excitation;
+    if (!exc->active) return 0.0f;
+
+    float t0 = exc->elapsed_ms;
+    float t1 = t0 + node->dt * 1000.0f;
+    float t_end = (t1 < exc->duration_ms) ? t1 : exc->duration_ms;
+
+    float integral_ms = hann_integral_ms(t_end, exc->duration_ms) -
+                        hann_integral_ms(t0, exc->duration_ms);
+
+    exc->elapsed_ms = t1;
+    if (t1 >= exc->duration_ms) {
+        exc->active = false;
+    }
+
+    return integral_ms * 0.001f;
+}
+
+void modal_node_step(modal_node_t* node) {
+    if (!node->running) return;
+
+    // Rebuild propagators only if omega/gamma/damping/personality/dt changed
+    modal_node_update_propagators(node);
+
+    const float dt = node->dt;
+
+    // Excitation drive for this step: Hann envelope integrated over dt
+    const bool exciting = node->excitation.active;
+    const float envelope_integral = modal_node_advance_excitation(node);
+    const float envelope = envelope_integral / dt;  // Mean envelope over the step
+
+    const bool self_oscillator = (node->personality == PERSONALITY_SELF_OSCILLATOR);
+
     // Integrate each mode
     for (int k = 0; k < MAX_MODES; k++) {
         if (!node->modes[k].params.active) continue;
@@ -141,15 +221,20 @@ void modal_node_step(modal_node_t* node) {
         float omega = mode->params.omega;
         float gamma = mode->params.gamma;
 
-        // Personality-specific dynamics
+        float complex propagator = mode->propagator;
         float effective_gamma = gamma;
-        if (node->personality == PERSONALITY_SELF_OSCILLATOR) {
+
+        if (self_oscillator) {
             // Self-oscillator: negative damping at low energy, positive at high
             float energy = cabsf(mode->a);
             float saturation_level = 1.0f;
 
             // Van der Pol-like: γ_eff = -γ + β*|a|²
-            effective_gamma = -gamma + 3.0f * gamma * (energy * energy) / (saturation_level * saturation_level);
+            // Fast path: cached exp((γ - γ_global + iω)dt) times the real
+            // amplitude-dependent factor exp(-β|a|²dt) - one expf, no cexpf
+            float saturation = 3.0f * gamma * (energy * energy) / (saturation_level * saturation_level);
+            effective_gamma = -gamma + saturation;
+            propagator *= expf(-saturation * dt);
         }
 
         // Apply global damping (circuit energy control)
@@ -159,13 +244,9 @@ void modal_node_step(modal_node_t* node) {
         // Linear dynamics: ȧ = (-γ + iω)a
         float complex linear_term = (-effective_gamma + I * omega) * mode->a;
 
-        // Excitation term (if envelope active)
+        // Excitation term (if envelope active during this step)
         float complex excitation_term = 0.0f;
-        if (node->excitation.active) {
-            // Envelope shape: Hann window
-            float t_norm = node->excitation.elapsed_ms / node->excitation.duration_ms;
-            float envelope = 0.5f * (1.0f - cosf(M_PI * t_norm));
-
+        if (exciting) {
             // Excitation with phase hint
             float phase = node->excitation.phase_hint;
             if (phase < 0.0f) {
@@ -181,18 +262,52 @@ void modal_node_step(modal_node_t* node) {
 
         // Exact exponential integration for linear part (more stable than Euler)
         // For ȧ = λa, exact solution over dt: a(t+dt) = a(t) * exp(λ*dt)
-        // We approximate: a_new ≈ a * exp(λ*dt) + excitation_contribution
+        // exp(λ*dt) comes from the per-mode propagator cache
 
-        float complex lambda = -effective_gamma + I * omega;
-        float complex exp_lambda_dt = cexpf(lambda * CONTROL_DT);
-
-        // Update: exact for linear + simple addition for excitation
-        mode->a = mode->a * exp_lambda_dt + excitation_term * CONTROL_DT;
+        // Update: exact for linear + integrated excitation drive + input drive
+        mode->a = mode->a * propagator + excitation_term * dt + mode->drive;
+        mode->a = denormal_snap(crealf(mode->a)) + I * denormal_snap(cimagf(mode->a));
+        mode->drive = 0.0f;
     }
 
     node->step_count++;
 }
 
+void modal_node_drive(modal_node_t* node,
+                      const float* input,
+                      uint32_t num_samples,
+                      float sample_rate,
+                      float gain) {
+    if (!input || sample_rate <= 0.0f) return;
+
+    if (node->drive_rate != sample_rate) {
+        node->drive_rate = sample_rate;
+        node->propagators_dirty = true;
+    }
+    modal_node_update_propagators(node);
+
+    const float scale = gain / sample_rate;
+
+    for (int k = 0; k < MAX_MODES; k++) {
+        mode_state_t* mode = &node->modes[k];
+        if (!mode->params.active) continue;
+
+        // Complex one-pole in real arithmetic, state in registers
+        const float p_re = crealf(mode->drive_propagator);
+        const float p_im = cimagf(mode->drive_propagator);
+        float d_re = crealf(mode->drive);
+        float d_im = cimagf(mode->drive);
+
+        for (uint32_t n = 0; n < num_samples; n++) {
+            float re = d_re * p_re - d_im * p_im + scale * input[n];
+            d_im = d_re * p_im + d_im * p_re;
+            d_re = re;
+        }
+
+        mode->drive = denormal_snap(d_re) + I * denormal_snap(d_im);
+    }
+}
+
 void modal_node_apply_poke(modal_node_t* node, const poke_event_t* poke) {
     // Set up excitation envelope
     node->excitation.strength = poke->strength;
@@ -230,6 +345,19 @@ float modal_node_get_amplitude(const modal_node_t* node) {
     return fminf(total / 2.0f, 1.0f);
 }
 
+bool modal_node_is_silent(const modal_node_t* node) {
+    if (node->personality == PERSONALITY_SELF_OSCILLATOR) return false;
+    if (node->excitation.active) return false;
+
+    float total = 0.0f;
+    for (int k = 0; k < MAX_MODES; k++) {
+        if (!node->modes[k].params.active) continue;
+        total += cabsf(node->modes[k].a) + cabsf(node->modes[k].drive);
+    }
+
+    return total < MODAL_NODE_SILENCE_LEVEL;
+}
+
 float modal_node_get_phase_modulation(const modal_node_t* node) {
     // Use mode 2 phase for timbre modulation
     if (!node->modes[2].params.active) return 0.0f;
@@ -259,6 +387,7 @@ void modal_node_reset(modal_node_t* node) {
     for (int k = 0; k < MAX_MODES; k++) {
         node->modes[k].a = 0.0f;
         node->modes[k].a_dot = 0.0f;
+        node->modes[k].drive = 0.0f;
     }
     node->excitation.active = false;
     node->step_count = 0;
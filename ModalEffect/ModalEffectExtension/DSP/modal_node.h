@@ -43,6 +43,7 @@ typedef struct {
 #define MAX_NEIGHBORS 8
 #define CONTROL_RATE_HZ 500  // 500 Hz control rate (2ms timestep)
 #define CONTROL_DT (1.0f / CONTROL_RATE_HZ)
+#define MODAL_NODE_SILENCE_LEVEL 1e-6f  // Summed |a_k| treated as silence (-120 dB)
 
 // ============================================================================
 // Type Definitions
@@ -86,6 +87,9 @@ typedef struct {
 typedef struct {
     modal_complex_t a;        ///< Complex amplitude a(t) = |a|e^(iφ)
     modal_complex_t a_dot;    ///< Time derivative (for integration)
+    modal_complex_t propagator; ///< Cached linear propagator exp(λ·dt)
+    modal_complex_t drive;    ///< Input drive accumulated since the last step
+    modal_complex_t drive_propagator; ///< Cached per-sample propagator exp(λ/fs)
     mode_params_t params;   ///< Mode parameters
 } mode_state_t;
 
@@ -118,8 +122,11 @@ typedef struct {
     float carrier_freq_hz;              ///< Base audio frequency (Hz)
     float audio_gain;                   ///< Master output gain [0,1]
 
+    float dt;                           ///< Integration timestep (s), CONTROL_DT by default
+    float drive_rate;                   ///< Sample rate of drive_propagator (0 = not driven yet)
     uint32_t step_count;                ///< Simulation step counter
     bool running;                       ///< Node running flag
+    bool propagators_dirty;             ///< Cached propagators need rebuild
 } modal_node_t;
 
 /**
@@ -157,6 +164,33 @@ void modal_node_init(modal_node_t* node, uint8_t node_id, node_personality_t per
 void modal_node_set_mode(modal_node_t* node, uint8_t mode_idx,
                          float omega, float gamma, float weight);
 
+/**
+ * @brief Set global damping (added to all modes)
+ *
+ * @param node Pointer to node structure
+ * @param damping Global damping coefficient (>= 0.0)
+ */
+void modal_node_set_global_damping(modal_node_t* node, float damping);
+
+/**
+ * @brief Set node personality
+ *
+ * @param node Pointer to node structure
+ * @param personality Resonator or self-oscillator
+ */
+void modal_node_set_personality(modal_node_t* node, node_personality_t personality);
+
+/**
+ * @brief Set integration timestep
+ *
+ * The host's control scheduler sets this to (tick length / sample rate) so
+ * the dynamics run in real time regardless of sample rate or tick size.
+ *
+ * @param node Pointer to node structure
+ * @param dt Timestep in seconds (> 0)
+ */
+void modal_node_set_dt(modal_node_t* node, float dt);
+
 /**
  * @brief Set node neighbors for coupling
  *
@@ -169,7 +203,32 @@ void modal_node_set_neighbors(modal_node_t* node,
                               uint8_t num_neighbors);
 
 /**
- * @brief Simulate one timestep (call at CONTROL_RATE_HZ)
+ * @brief Rebuild cached per-mode propagators if parameters changed
+ *
+ * Each mode caches P = exp((-γ_lin + iω)·dt), where γ_lin = γ + global_damping
+ * for resonators and -γ + global_damping for self-oscillators (whose
+ * amplitude-dependent term is applied separately every step). The cache is
+ * invalidated by modal_node_set_mode(), modal_node_set_global_damping(),
+ * modal_node_set_personality() and modal_node_set_dt(). Called automatically by modal_node_step().
+ *
+ * @param node Pointer to node structure
+ */
+void modal_node_update_propagators(modal_node_t* node);
+
+/**
+ * @brief Advance the excitation envelope by one timestep
+ *
+ * Returns the Hann envelope integrated over [elapsed, elapsed + dt] (in
+ * seconds), so the total drive of a poke is the same at any control rate -
+ * even when dt is longer than the envelope itself.
+ *
+ * @param node Pointer to node structure
+ * @return ∫ envelope dt over this step (0 if no excitation is active)
+ */
+float modal_node_advance_excitation(modal_node_t* node);
+
+/**
+ * @brief Simulate one timestep of node->dt seconds
  *
  * This function integrates the modal dynamics for one timestep using
  * exact exponential integration for numerical stability.
@@ -189,6 +248,33 @@ void modal_node_step(modal_node_t* node);
  */
 void modal_node_apply_poke(modal_node_t* node, const poke_event_t* poke);
 
+/**
+ * @brief Drive the modes with a continuous audio-rate input
+ *
+ * Each active mode runs the input through a complex one-pole resonator
+ * with its own pole λ_k = -γ_k + iω_k (linear damping, as in the cached
+ * propagators):
+ *
+ *     d_k ← d_k · exp(λ_k/fs) + gain · x[n] / fs
+ *
+ * i.e. the exact response of ȧ = λa + gain·x(t) to the input since the last
+ * step. The next modal_node_step() (or modal_bank_step()) adds d_k to a_k and
+ * clears it, so the input samples fed between two steps should span one
+ * control tick (node->dt). Cost is fixed per sample and mode, independent
+ * of the input level; no envelope or events are involved.
+ *
+ * @param node Pointer to node structure
+ * @param input Input samples
+ * @param num_samples Number of samples
+ * @param sample_rate Input sample rate in Hz
+ * @param gain Drive gain
+ */
+void modal_node_drive(modal_node_t* node,
+                      const float* input,
+                      uint32_t num_samples,
+                      float sample_rate,
+                      float gain);
+
 /**
  * @brief Get current audio amplitude (for synthesis)
  *
@@ -199,6 +285,20 @@ void modal_node_apply_poke(modal_node_t* node, const poke_event_t* poke);
  */
 float modal_node_get_amplitude(const modal_node_t* node);
 
+/**
+ * @brief Check if a node has decayed to silence
+ *
+ * True when the summed mode magnitudes |a_k| (plus any pending input
+ * drive) are below MODAL_NODE_SILENCE_LEVEL and no poke envelope is
+ * running. Stepping such a node only decays it further, so its owner may
+ * stop stepping and rendering it until it is excited again.
+ * Self-oscillators are never silent (they grow back from any residue).
+ *
+ * @param node Pointer to node structure
+ * @return True if the node can sleep
+ */
+bool modal_node_is_silent(const modal_node_t* node);
+
 /**
  * @brief Get phase modulation (from mode 2)
  *
@@ -16,5 +16,8 @@ typedef NS_ENUM(AUParameterAddress, ModalEffectExtensionParameterAddress) {
     kParam_Material = 1,     // Material hardness [0, 1] - controls damping
     kParam_Excite = 2,       // Excitation amount [0, 1] - input drive
     kParam_Morph = 3,        // Pitch tracking amount [0, 1] - morphing
-    kParam_Mix = 4           // Dry/wet mix [0, 1] - effect blend
+    kParam_Mix = 4,          // Dry/wet mix [0, 1] - effect blend
+
+    // Analysis parameters
+    kParam_Lookahead = 5     // Onset lookahead [0, 50] ms - dry delay, reported as latency
 };
@@ -58,6 +58,21 @@ let ModalEffectExtensionParameterSpecs = ParameterTreeSpec {
             defaultValue: 0.5
         )
     }
+
+    // MARK: - Analysis Parameters
+    ParameterGroupSpec(identifier: "analysis", name: "Analysis") {
+        // Delays the dry signal so resonances start with the attack;
+        // changes the latency, so it is not automatable
+        ParameterSpec(
+            address: ModalEffectExtensionParameterAddress.param_Lookahead,
+            identifier: "lookahead",
+            name: "Lookahead",
+            units: .milliseconds,
+            valueRange: 0.0...50.0,
+            defaultValue: 0.0,
+            flags: [.flag_IsWritable, .flag_IsReadable, .flag_NonRealTime]
+        )
+    }
 }
 
 // Extension to make parameter addresses work with ParameterSpec
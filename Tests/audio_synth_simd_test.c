@@ -0,0 +1,254 @@
+/**
+ * @file audio_synth_simd_test.c
+ * @brief SIMD sine kernels against the scalar reference
+ *
+ * For every implementation level that audio_synth_simd_select() accepts on
+ * the running CPU, random 4-mode blocks are rendered by the selected kernel
+ * and by audio_synth_sine4_scalar() from the same state, and the outputs and
+ * final phasors are compared. Blocks cover:
+ * - random frequencies and phases, odd block lengths (vector tails)
+ * - inactive and non-sine lanes, masked the way audio_synth.c masks them
+ *   (zero ramp, identity rotation; the phasor must come back untouched)
+ * - rising, falling and clipped amplitude ramps
+ * - accumulation into a non-zero output buffer
+ *
+ * The batch entry point is checked the same way against a per-node scalar
+ * render, clamp and pan.
+ *
+ * Tolerances (absolute, blocks up to MAX_TEST_FRAMES):
+ * - SSE2/NEON: separate multiply and add, only the 4-lane sum order
+ *   differs from the scalar kernel
+ * - AVX2/AVX-512: FMA plus a doubled rotation for odd samples, so the
+ *   phasor drifts slightly from the scalar recurrence over a block
+ */
+
+#include "audio_synth_simd.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define NUM_TRIALS 2000
+#define MAX_TEST_FRAMES 512
+#define MAX_BATCH_NODES 7
+
+#define SEPARATE_MUL_ADD_TOLERANCE 1e-6f
+#define FMA_TOLERANCE 1e-4f
+
+#define TEST_AMP_MAX 0.7f                   // MAX_AMPLITUDE_SCALE in audio_synth.c
+
+// ============================================================================
+// Random State
+// ============================================================================
+
+static uint32_t rng_state = 0x2545F491u;
+
+static uint32_t rng_next(void) {
+    // xorshift32: fixed seed, so failures are reproducible
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static float rng_uniform(float lo, float hi) {
+    return lo + (hi - lo) * (float)(rng_next() >> 8) * (1.0f / 16777216.0f);
+}
+
+static void random_sine4(audio_synth_sine4_t* state, uint32_t num_frames) {
+    memset(state, 0, sizeof(*state));
+
+    for (int k = 0; k < MAX_MODES; k++) {
+        const float phase = rng_uniform(0.0f, 6.2831853f);
+        state->osc_re[k] = cosf(phase);
+        state->osc_im[k] = sinf(phase);
+
+        // One in four lanes is inactive or a non-sine shape: masked
+        if ((rng_next() & 3) == 0) {
+            state->rot_re[k] = 1.0f;
+            state->rot_im[k] = 0.0f;
+            continue;
+        }
+
+        // Up to Nyquist/2 at any rate
+        const float phase_inc = rng_uniform(0.0f, 1.5707963f);
+        state->rot_re[k] = cosf(phase_inc);
+        state->rot_im[k] = sinf(phase_inc);
+
+        // Ramp from start to end over the block; end may pass the clip
+        const float start = rng_uniform(0.0f, 0.5f);
+        const float end = rng_uniform(0.0f, 1.0f);
+        state->amp_start[k] = start;
+        state->amp_step[k] = (rng_next() & 1) ? (end - start) / (float)num_frames : 0.0f;
+    }
+
+    state->amp_max = TEST_AMP_MAX;
+    state->gain_l = rng_uniform(0.0f, 1.0f);
+    state->gain_r = rng_uniform(0.0f, 1.0f);
+}
+
+static void random_buffer(float* buffer, uint32_t num_frames) {
+    for (uint32_t i = 0; i < num_frames; i++) {
+        buffer[i] = rng_uniform(-0.5f, 0.5f);
+    }
+}
+
+// ============================================================================
+// Comparison
+// ============================================================================
+
+static float max_difference(const float* a, const float* b, uint32_t count) {
+    float worst = 0.0f;
+    for (uint32_t i = 0; i < count; i++) {
+        worst = fmaxf(worst, fabsf(a[i] - b[i]));
+    }
+    return worst;
+}
+
+static float tolerance_for(audio_synth_simd_t level) {
+    switch (level) {
+        case AUDIO_SYNTH_SIMD_AVX2:
+        case AUDIO_SYNTH_SIMD_AVX512:
+            return FMA_TOLERANCE;
+        default:
+            return SEPARATE_MUL_ADD_TOLERANCE;
+    }
+}
+
+/**
+ * @brief Masked lanes must keep their phasor exactly
+ */
+static bool masked_lanes_unchanged(const audio_synth_sine4_t* before,
+                                   const audio_synth_sine4_t* after) {
+    for (int k = 0; k < MAX_MODES; k++) {
+        if (before->rot_re[k] == 1.0f && before->rot_im[k] == 0.0f &&
+            (after->osc_re[k] != before->osc_re[k] || after->osc_im[k] != before->osc_im[k])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// Tests
+// ============================================================================
+
+static bool test_single(audio_synth_simd_t level) {
+    const float tolerance = tolerance_for(level);
+    float worst_out = 0.0f, worst_phasor = 0.0f;
+
+    for (int trial = 0; trial < NUM_TRIALS; trial++) {
+        const uint32_t num_frames = 1 + rng_next() % MAX_TEST_FRAMES;
+
+        audio_synth_sine4_t initial, reference, vector;
+        random_sine4(&initial, num_frames);
+        reference = initial;
+        vector = initial;
+
+        float out_reference[MAX_TEST_FRAMES], out_vector[MAX_TEST_FRAMES];
+        random_buffer(out_reference, num_frames);
+        memcpy(out_vector, out_reference, num_frames * sizeof(float));
+
+        audio_synth_sine4_scalar(&reference, out_reference, num_frames);
+        audio_synth_sine4(&vector, out_vector, num_frames);
+
+        const float out_diff = max_difference(out_reference, out_vector, num_frames);
+        const float phasor_diff = fmaxf(
+            max_difference(reference.osc_re, vector.osc_re, MAX_MODES),
+            max_difference(reference.osc_im, vector.osc_im, MAX_MODES));
+        worst_out = fmaxf(worst_out, out_diff);
+        worst_phasor = fmaxf(worst_phasor, phasor_diff);
+
+        if (out_diff > tolerance || phasor_diff > tolerance) {
+            fprintf(stderr, "%s: trial %d (%u frames) differs by %g (phasor %g), tolerance %g\n",
+                    audio_synth_simd_name(level), trial, num_frames,
+                    out_diff, phasor_diff, tolerance);
+            return false;
+        }
+        if (!masked_lanes_unchanged(&initial, &vector)) {
+            fprintf(stderr, "%s: trial %d moved a masked lane\n",
+                    audio_synth_simd_name(level), trial);
+            return false;
+        }
+    }
+
+    printf("%-9s sine4: max diff %.3g (phasor %.3g), tolerance %.3g\n",
+           audio_synth_simd_name(level), worst_out, worst_phasor, tolerance);
+    return true;
+}
+
+static bool test_batch(audio_synth_simd_t level) {
+    const float tolerance = tolerance_for(level);
+    float worst = 0.0f;
+
+    for (int trial = 0; trial < NUM_TRIALS / 4; trial++) {
+        const uint32_t num_frames = 1 + rng_next() % MAX_TEST_FRAMES;
+        const uint32_t count = 1 + rng_next() % MAX_BATCH_NODES;
+        const bool stereo = (rng_next() & 1) != 0;
+
+        audio_synth_sine4_t states[MAX_BATCH_NODES];
+        for (uint32_t n = 0; n < count; n++) {
+            random_sine4(&states[n], num_frames);
+        }
+
+        // Reference: scalar render per node, clamp, pan
+        float refL[MAX_TEST_FRAMES], refR[MAX_TEST_FRAMES];
+        float outL[MAX_TEST_FRAMES], outR[MAX_TEST_FRAMES];
+        random_buffer(refL, num_frames);
+        random_buffer(refR, num_frames);
+        memcpy(outL, refL, num_frames * sizeof(float));
+        memcpy(outR, refR, num_frames * sizeof(float));
+
+        for (uint32_t n = 0; n < count; n++) {
+            audio_synth_sine4_t node = states[n];
+            float mono[MAX_TEST_FRAMES] = {0};
+            audio_synth_sine4_scalar(&node, mono, num_frames);
+
+            for (uint32_t i = 0; i < num_frames; i++) {
+                const float sample = fminf(fmaxf(mono[i], -1.0f), 1.0f);
+                refL[i] += node.gain_l * sample;
+                if (stereo) refR[i] += node.gain_r * sample;
+            }
+        }
+
+        audio_synth_sine4_batch(states, count, outL, stereo ? outR : NULL, num_frames);
+
+        const float diff = fmaxf(max_difference(refL, outL, num_frames),
+                                 max_difference(refR, outR, num_frames));
+        worst = fmaxf(worst, diff);
+
+        // Gains sum up to count, so scale the per-node tolerance
+        if (diff > tolerance * (float)count) {
+            fprintf(stderr, "%s: batch trial %d (%u nodes, %u frames) differs by %g\n",
+                    audio_synth_simd_name(level), trial, count, num_frames, diff);
+            return false;
+        }
+    }
+
+    printf("%-9s batch: max diff %.3g\n", audio_synth_simd_name(level), worst);
+    return true;
+}
+
+int main(void) {
+    static const audio_synth_simd_t levels[] = {
+        AUDIO_SYNTH_SIMD_SCALAR,
+        AUDIO_SYNTH_SIMD_SSE2,
+        AUDIO_SYNTH_SIMD_AVX2,
+        AUDIO_SYNTH_SIMD_NEON,
+        AUDIO_SYNTH_SIMD_AVX512,
+    };
+
+    bool ok = true;
+    for (size_t i = 0; i < sizeof(levels) / sizeof(levels[0]); i++) {
+        // select() falls back to the detected level when unsupported
+        if (audio_synth_simd_select(levels[i]) != levels[i]) {
+            printf("%-9s not available, skipped\n", audio_synth_simd_name(levels[i]));
+            continue;
+        }
+
+        ok = test_single(levels[i]) && ok;
+        ok = test_batch(levels[i]) && ok;
+    }
+
+    audio_synth_simd_select(audio_synth_simd_detect());
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,242 @@
+/**
+ * @file modal_bank_test.c
+ * @brief modal_bank_step() against per-node modal_node_step()
+ *
+ * modal_bank_step() promises the dynamics of calling modal_node_step() on
+ * every selected, running node. The same 5-node network is run twice from
+ * the same rand() seed (node init and random poke phases draw from it, in
+ * the same order on both paths): once through a bank, once node by node.
+ * Along the way it gets everything that touches the propagator cache or the
+ * drive terms:
+ * - pokes with fixed and random phase
+ * - continuous input through modal_node_drive() on two nodes
+ * - set_mode(), global damping, personality and dt changes mid-run
+ * - resonators and self-oscillators, nodes with inactive modes
+ * - a node masked out for a while, and a node stopped
+ *
+ * After every step each mode amplitude must match within STATE_TOLERANCE
+ * of the network's peak amplitude (the two paths only differ in float
+ * evaluation order), and step counters must match exactly.
+ */
+
+#include "modal_bank.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_NODES 5
+#define TEST_STEPS 1500
+#define TEST_SAMPLE_RATE 48000.0f
+#define TEST_DRIVE_GAIN 20.0f
+
+#define STATE_TOLERANCE 1e-5f               // Relative to the peak |a|
+#define MIN_PEAK 1e-2f
+
+#define PHASE_SEED 4242u
+
+// Event steps
+#define STEP_RETUNE 100
+#define STEP_MASK_START 200
+#define STEP_DAMPING 300
+#define STEP_MASK_END 400
+#define STEP_SELF_OSCILLATE 500
+#define STEP_DT 700
+#define STEP_RESONATE 900
+#define STEP_POKE 1000
+#define STEP_STOP 1200
+
+#define MASKED_NODE 4
+#define STOPPED_NODE 3
+
+typedef struct {
+    modal_complex_t a[TEST_STEPS][TEST_NODES][MAX_MODES];
+    uint32_t step_count[TEST_STEPS][TEST_NODES];
+} trajectory_t;
+
+// ============================================================================
+// Network
+// ============================================================================
+
+static void init_network(modal_node_t* nodes) {
+    static const float base_freqs[TEST_NODES] = { 110.0f, 220.0f, 164.8f, 330.0f, 82.4f };
+    static const float ratios[MAX_MODES] = { 1.0f, 2.01f, 2.98f, 4.1f };
+
+    for (uint32_t n = 0; n < TEST_NODES; n++) {
+        const node_personality_t personality = (n == 4) ? PERSONALITY_SELF_OSCILLATOR
+                                                        : PERSONALITY_RESONATOR;
+        modal_node_init(&nodes[n], (uint8_t)n, personality);
+
+        // Node 2 leaves its upper modes inactive
+        const uint32_t num_modes = (n == 2) ? 2 : MAX_MODES;
+        for (uint32_t k = 0; k < num_modes; k++) {
+            modal_node_set_mode(&nodes[n], (uint8_t)k,
+                                freq_to_omega(base_freqs[n] * ratios[k]),
+                                0.5f + 0.7f * k + 0.3f * n, 1.0f / (k + 1));
+        }
+        modal_node_start(&nodes[n]);
+    }
+}
+
+static void poke(modal_node_t* node, float strength, float phase_hint) {
+    poke_event_t event = {
+        .source_node_id = 0,
+        .strength = strength,
+        .phase_hint = phase_hint,
+        .mode_weights = { 1.0f, 0.7f, 0.5f, 0.3f },
+    };
+    modal_node_apply_poke(node, &event);
+}
+
+/**
+ * Parameter changes and pokes due before step s (same on both paths)
+ */
+static void apply_events(modal_node_t* nodes, uint32_t s) {
+    switch (s) {
+        case 0:
+            poke(&nodes[0], 2.0f, 0.5f);
+            poke(&nodes[2], 1.5f, -1.0f);
+            break;
+        case STEP_RETUNE:
+            modal_node_set_mode(&nodes[1], 2, freq_to_omega(700.0f), 1.2f, 0.4f);
+            break;
+        case STEP_DAMPING:
+            modal_node_set_global_damping(&nodes[3], 2.0f);
+            break;
+        case STEP_SELF_OSCILLATE:
+            modal_node_set_personality(&nodes[1], PERSONALITY_SELF_OSCILLATOR);
+            break;
+        case STEP_DT:
+            for (uint32_t n = 0; n < TEST_NODES; n++) {
+                modal_node_set_dt(&nodes[n], 1.0f / 1000.0f);
+            }
+            break;
+        case STEP_RESONATE:
+            modal_node_set_personality(&nodes[1], PERSONALITY_RESONATOR);
+            break;
+        case STEP_POKE:
+            poke(&nodes[3], 3.0f, -1.0f);
+            poke(&nodes[1], 1.0f, 2.0f);
+            break;
+        case STEP_STOP:
+            modal_node_stop(&nodes[STOPPED_NODE]);
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * Input for one tick into nodes 0 and 2: a 196 Hz sine
+ */
+static void drive(modal_node_t* nodes, uint64_t* sample_pos) {
+    float input[96];
+    const uint32_t count = (uint32_t)(nodes[0].dt * TEST_SAMPLE_RATE + 0.5f);
+
+    for (uint32_t i = 0; i < count; i++) {
+        const double t = (double)(*sample_pos + i) / TEST_SAMPLE_RATE;
+        input[i] = 0.5f * (float)sin(2.0 * M_PI * 196.0 * t);
+    }
+    *sample_pos += count;
+
+    modal_node_drive(&nodes[0], input, count, TEST_SAMPLE_RATE, TEST_DRIVE_GAIN);
+    modal_node_drive(&nodes[2], input, count, TEST_SAMPLE_RATE, TEST_DRIVE_GAIN);
+}
+
+static uint32_t step_mask(uint32_t s) {
+    uint32_t mask = (1u << TEST_NODES) - 1;
+    if (s >= STEP_MASK_START && s < STEP_MASK_END) {
+        mask &= ~(1u << MASKED_NODE);
+    }
+    return mask;
+}
+
+static void run_network(bool use_bank, trajectory_t* trajectory) {
+    static modal_node_t nodes[TEST_NODES];
+    static modal_bank_t bank;
+
+    srand(PHASE_SEED);
+    init_network(nodes);
+
+    modal_bank_init(&bank, TEST_NODES);
+    for (uint32_t n = 0; n < TEST_NODES; n++) {
+        modal_bank_bind_node(&bank, n, &nodes[n]);
+    }
+
+    uint64_t sample_pos = 0;
+    for (uint32_t s = 0; s < TEST_STEPS; s++) {
+        apply_events(nodes, s);
+        drive(nodes, &sample_pos);
+
+        const uint32_t mask = step_mask(s);
+        if (use_bank) {
+            modal_bank_step(&bank, mask);
+        } else {
+            for (uint32_t n = 0; n < TEST_NODES; n++) {
+                if ((mask >> n) & 1u) {
+                    modal_node_step(&nodes[n]);
+                }
+            }
+        }
+
+        for (uint32_t n = 0; n < TEST_NODES; n++) {
+            for (uint32_t k = 0; k < MAX_MODES; k++) {
+                trajectory->a[s][n][k] = nodes[n].modes[k].a;
+            }
+            trajectory->step_count[s][n] = nodes[n].step_count;
+        }
+    }
+}
+
+// ============================================================================
+// Test
+// ============================================================================
+
+int main(void) {
+    static trajectory_t reference, banked;
+
+    run_network(false, &reference);
+    run_network(true, &banked);
+
+    float peak = 0.0f;
+    for (uint32_t s = 0; s < TEST_STEPS; s++) {
+        for (uint32_t n = 0; n < TEST_NODES; n++) {
+            for (uint32_t k = 0; k < MAX_MODES; k++) {
+                peak = fmaxf(peak, cabsf(reference.a[s][n][k]));
+            }
+        }
+    }
+
+    bool ok = true;
+    if (peak < MIN_PEAK) {
+        printf("peak |a| %.3g too low to compare FAILED\n", peak);
+        ok = false;
+    }
+
+    // Per node: worst deviation, and whether the step counters agree
+    for (uint32_t n = 0; n < TEST_NODES; n++) {
+        float worst = 0.0f;
+        uint32_t worst_step = 0;
+        bool counts_match = true;
+
+        for (uint32_t s = 0; s < TEST_STEPS; s++) {
+            for (uint32_t k = 0; k < MAX_MODES; k++) {
+                const float diff = cabsf(banked.a[s][n][k] - reference.a[s][n][k]);
+                if (diff > worst) {
+                    worst = diff;
+                    worst_step = s;
+                }
+            }
+            counts_match = counts_match &&
+                           banked.step_count[s][n] == reference.step_count[s][n];
+        }
+
+        const bool pass = worst <= STATE_TOLERANCE * peak && counts_match;
+        printf("node %u: max |a| diff %.3g (step %u, peak %.3g), %u steps%s%s\n", n, worst,
+               worst_step, peak, reference.step_count[TEST_STEPS - 1][n],
+               counts_match ? "" : ", step count mismatch", pass ? "" : " FAILED");
+        ok = ok && pass;
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,160 @@
+/**
+ * @file onset_detector_test.c
+ * @brief Onset positions independent of the host buffer size
+ *
+ * The detector works on its own hops, so the events it finds must not
+ * depend on how the host cuts the stream into buffers. A sequence of
+ * plucked notes (exponentially decaying harmonic tones at different
+ * pitches and levels, with long rests before and after the last note,
+ * so releases fire too) is processed at buffer
+ * sizes from 32 to 2048, odd ones included, and every run must report
+ * exactly the events of the first one: type, absolute position, level and
+ * brightness. Each event's offset must match its position inside the
+ * buffer it was reported in (offset 0 for a position before the buffer).
+ *
+ * The reference run must find one onset within ONSET_LOCATE_TOLERANCE of
+ * every note start and at least one release, so an empty event list cannot
+ * pass.
+ */
+
+#include "OnsetDetector.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_SAMPLE_RATE 48000.0f
+#define TEST_HOP_SIZE 64
+#define TEST_FRAMES (6 * 48000)
+
+#define MAX_TEST_EVENTS 256
+#define ONSET_LOCATE_TOLERANCE 480          // 10 ms
+
+typedef struct {
+    uint32_t start;                         // Sample
+    float freq;                             // Hz
+    float level;                            // Peak amplitude
+} test_note_t;
+
+static const test_note_t NOTES[] = {
+    {  4800, 110.0f, 0.5f },
+    { 28800, 220.0f, 0.3f },
+    { 52800, 164.8f, 0.6f },
+    { 72000, 440.0f, 0.2f },
+    { 96000, 82.4f, 0.7f },
+    { 120000, 659.3f, 0.4f },
+    { 216000, 330.0f, 0.5f },
+};
+#define NUM_NOTES (sizeof(NOTES) / sizeof(NOTES[0]))
+
+typedef struct {
+    onset_event_t events[MAX_TEST_EVENTS];
+    uint32_t count;
+    bool offsets_ok;
+} event_list_t;
+
+static void render_notes(float* output, uint32_t num_frames) {
+    memset(output, 0, num_frames * sizeof(float));
+
+    for (size_t n = 0; n < NUM_NOTES; n++) {
+        const test_note_t* note = &NOTES[n];
+        for (uint32_t i = note->start; i < num_frames; i++) {
+            const double t = (double)(i - note->start) / TEST_SAMPLE_RATE;
+            const double envelope = note->level * exp(-t / 0.15);
+            double sample = 0.0;
+            for (int k = 1; k <= 3; k++) {
+                sample += sin(2.0 * M_PI * note->freq * k * t) / k;
+            }
+            output[i] += (float)(envelope * sample);
+        }
+    }
+}
+
+static void detect(const float* input, uint32_t num_frames, uint32_t block_size,
+                   event_list_t* list) {
+    onset_detector_t detector;
+    onset_detector_init(&detector, TEST_SAMPLE_RATE, TEST_HOP_SIZE);
+
+    list->count = 0;
+    list->offsets_ok = true;
+
+    onset_event_t events[ONSET_MAX_EVENTS];
+    for (uint32_t start = 0; start < num_frames; start += block_size) {
+        const uint32_t n = (num_frames - start < block_size) ? num_frames - start : block_size;
+        const uint32_t found = onset_detector_process(&detector, input + start, n,
+                                                      events, ONSET_MAX_EVENTS);
+
+        for (uint32_t e = 0; e < found && list->count < MAX_TEST_EVENTS; e++) {
+            const uint64_t expected = (events[e].position > start) ? events[e].position - start : 0;
+            if (events[e].offset != expected) {
+                list->offsets_ok = false;
+            }
+            list->events[list->count++] = events[e];
+        }
+    }
+}
+
+static bool same_event(const onset_event_t* a, const onset_event_t* b) {
+    return a->type == b->type && a->position == b->position &&
+           a->level == b->level && a->centroid_hz == b->centroid_hz;
+}
+
+// Every note start has one onset close to it
+static bool onsets_located(const event_list_t* list) {
+    for (size_t n = 0; n < NUM_NOTES; n++) {
+        uint32_t hits = 0;
+        for (uint32_t e = 0; e < list->count; e++) {
+            const onset_event_t* event = &list->events[e];
+            if (event->type != ONSET_EVENT_ONSET) continue;
+            const int64_t distance = (int64_t)event->position - (int64_t)NOTES[n].start;
+            if (distance >= -ONSET_LOCATE_TOLERANCE && distance <= ONSET_LOCATE_TOLERANCE) {
+                hits++;
+            }
+        }
+        if (hits != 1) {
+            fprintf(stderr, "note at %u: %u onsets nearby\n", NOTES[n].start, hits);
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(void) {
+    static const uint32_t block_sizes[] = { 32, 64, 100, 128, 256, 333, 512, 1000, 1024, 2048 };
+    static float input[TEST_FRAMES];
+    static event_list_t reference, run;
+
+    render_notes(input, TEST_FRAMES);
+
+    // Reference: one hop per call
+    detect(input, TEST_FRAMES, TEST_HOP_SIZE, &reference);
+    uint32_t onsets = 0;
+    for (uint32_t e = 0; e < reference.count; e++) {
+        onsets += (reference.events[e].type == ONSET_EVENT_ONSET) ? 1 : 0;
+    }
+    printf("reference: %u onsets, %u releases\n", onsets, reference.count - onsets);
+
+    bool ok = onsets_located(&reference) && reference.offsets_ok;
+    if (onsets == reference.count) {
+        fprintf(stderr, "reference: no release\n");
+        ok = false;
+    }
+
+    for (size_t b = 0; b < sizeof(block_sizes) / sizeof(block_sizes[0]); b++) {
+        detect(input, TEST_FRAMES, block_sizes[b], &run);
+
+        bool same = run.count == reference.count;
+        for (uint32_t e = 0; same && e < run.count; e++) {
+            same = same_event(&run.events[e], &reference.events[e]);
+        }
+
+        const bool pass = same && run.offsets_ok;
+        printf("block %4u: %u events%s%s%s\n", block_sizes[b], run.count,
+               same ? "" : ", differ from reference",
+               run.offsets_ok ? "" : ", offset mismatch",
+               pass ? "" : " FAILED");
+        ok = ok && pass;
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,214 @@
+/**
+ * @file pitch_detector_test.c
+ * @brief FFT and FFT-based YIN against direct computation
+ *
+ * - FFT: forward against a direct DFT (double precision), and the inverse
+ *   round trip, at power-of-2 sizes up to the detector's transform size
+ * - difference function: after a complete analysis the detector's yin[]
+ *   holds the cumulative mean normalized d'(τ), computed from one packed
+ *   two-real-signal FFT round trip; it is compared with d'(τ) built from
+ *   the direct O(N²) sum d(τ) = Σ_{j<W} (x_j - x_{j+τ})²
+ * - pitch: harmonic tones from 82 Hz to 1760 Hz (fundamental plus 3
+ *   harmonics at 1/k amplitude) must come back within PITCH_TOLERANCE_CENTS
+ */
+
+#include "PitchDetector.h"
+#include "fft.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_SAMPLE_RATE 48000.0f
+#define TEST_MIN_FREQ 60.0f
+#define TEST_MAX_FREQ 2000.0f
+#define TEST_WINDOW_MS 50.0f
+#define TEST_SMOOTHING_MS 100.0f
+
+#define MAX_FFT_SIZE 4096
+
+#define FFT_TOLERANCE 1e-4                  // Relative to the RMS of the spectrum
+#define ROUND_TRIP_TOLERANCE 1e-5f          // Absolute, inputs in [-1, 1]
+#define YIN_TOLERANCE 1e-4f                 // Absolute on d'(τ) (about 1 in [0, 2])
+#define PITCH_TOLERANCE_CENTS 1.5
+
+// ============================================================================
+// Random State
+// ============================================================================
+
+static uint32_t rng_state = 0x9E3779B9u;
+
+static float rng_uniform(float lo, float hi) {
+    // xorshift32: fixed seed, so failures are reproducible
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return lo + (hi - lo) * (float)(rng_state >> 8) * (1.0f / 16777216.0f);
+}
+
+// ============================================================================
+// FFT
+// ============================================================================
+
+static bool test_fft(uint32_t size) {
+    static float re[MAX_FFT_SIZE], im[MAX_FFT_SIZE];
+    static float in_re[MAX_FFT_SIZE], in_im[MAX_FFT_SIZE];
+
+    fft_t fft;
+    if (!fft_init(&fft, size) || fft.size != size) {
+        fprintf(stderr, "fft %u: init failed\n", size);
+        return false;
+    }
+
+    for (uint32_t n = 0; n < size; n++) {
+        in_re[n] = re[n] = rng_uniform(-1.0f, 1.0f);
+        in_im[n] = im[n] = rng_uniform(-1.0f, 1.0f);
+    }
+
+    // Forward against the direct DFT
+    fft_forward(&fft, re, im);
+
+    double worst = 0.0, power = 0.0;
+    for (uint32_t k = 0; k < size; k++) {
+        double sum_re = 0.0, sum_im = 0.0;
+        for (uint32_t n = 0; n < size; n++) {
+            const double angle = -2.0 * M_PI * (double)((uint64_t)k * n % size) / size;
+            sum_re += in_re[n] * cos(angle) - in_im[n] * sin(angle);
+            sum_im += in_re[n] * sin(angle) + in_im[n] * cos(angle);
+        }
+        worst = fmax(worst, hypot(re[k] - sum_re, im[k] - sum_im));
+        power += sum_re * sum_re + sum_im * sum_im;
+    }
+    const double rms = sqrt(power / size);
+
+    // Round trip
+    fft_inverse(&fft, re, im);
+
+    float worst_round_trip = 0.0f;
+    for (uint32_t n = 0; n < size; n++) {
+        worst_round_trip = fmaxf(worst_round_trip, fabsf(re[n] / (float)size - in_re[n]));
+        worst_round_trip = fmaxf(worst_round_trip, fabsf(im[n] / (float)size - in_im[n]));
+    }
+    fft_cleanup(&fft);
+
+    const bool ok = (worst <= FFT_TOLERANCE * rms) && (worst_round_trip <= ROUND_TRIP_TOLERANCE);
+    printf("fft %5u: dft diff %.3g (rms %.3g), round trip %.3g%s\n",
+           size, worst, rms, worst_round_trip, ok ? "" : " FAILED");
+    return ok;
+}
+
+// ============================================================================
+// YIN
+// ============================================================================
+
+static void harmonic_tone(float* out, uint32_t count, float freq, float phase0) {
+    for (uint32_t i = 0; i < count; i++) {
+        const double t = (double)i / TEST_SAMPLE_RATE;
+        double sample = 0.0;
+        for (int k = 1; k <= 4; k++) {
+            sample += sin(2.0 * M_PI * freq * k * t + phase0 * k) / k;
+        }
+        out[i] = 0.4f * (float)sample;
+    }
+}
+
+static void init_detector(pitch_detector_t* detector) {
+    pitch_detector_init(detector, TEST_SAMPLE_RATE, TEST_MIN_FREQ, TEST_MAX_FREQ,
+                        TEST_WINDOW_MS, TEST_SMOOTHING_MS);
+}
+
+/**
+ * d'(τ) from the direct difference function over the linearized buffer
+ * (same window and lag range as the detector), against the detector's.
+ */
+static bool test_difference_function(float freq) {
+    pitch_detector_t detector;
+    init_detector(&detector);
+
+    // More than a buffer, so the ring has wrapped
+    const uint32_t size = detector.buffer_size;
+    const uint32_t count = size + size / 3;
+    float* input = malloc(count * sizeof(float));
+    harmonic_tone(input, count, freq, 0.3f);
+    for (uint32_t i = 0; i < count; i++) {
+        input[i] += 0.05f * rng_uniform(-1.0f, 1.0f);
+    }
+
+    pitch_detector_process_buffer(&detector, input, count);
+    pitch_detector_analyze(&detector);
+
+    // Same lag range and window as begin_analysis()
+    const float* x = input + count - size;
+    uint32_t max_lag = (uint32_t)(TEST_SAMPLE_RATE / TEST_MIN_FREQ);
+    if (max_lag > size / 2) max_lag = size / 2;
+    const uint32_t window = size - max_lag;
+
+    double running_sum = 0.0;
+    float worst = 0.0f;
+    for (uint32_t lag = 1; lag <= max_lag; lag++) {
+        double d = 0.0;
+        for (uint32_t j = 0; j < window; j++) {
+            const double diff = (double)x[j] - x[j + lag];
+            d += diff * diff;
+        }
+        running_sum += d;
+        const double normalized = (running_sum > 0.0) ? d * lag / running_sum : 1.0;
+        worst = fmaxf(worst, fabsf((float)normalized - detector.yin[lag]));
+    }
+
+    pitch_detector_cleanup(&detector);
+    free(input);
+
+    const bool ok = worst <= YIN_TOLERANCE;
+    printf("yin %7.2f Hz: d'(tau) diff %.3g over %u lags%s\n", freq, worst, max_lag,
+           ok ? "" : " FAILED");
+    return ok;
+}
+
+static bool test_pitch(float freq) {
+    pitch_detector_t detector;
+    init_detector(&detector);
+
+    const uint32_t count = 2 * detector.buffer_size;
+    float* input = malloc(count * sizeof(float));
+    harmonic_tone(input, count, freq, 1.0f);
+
+    pitch_detector_process_buffer(&detector, input, count);
+    pitch_detector_analyze(&detector);
+
+    const bool valid = pitch_detector_is_valid(&detector);
+    const float detected = pitch_detector_get_pitch(&detector);
+    const double cents = valid ? 1200.0 * log2((double)detected / freq) : INFINITY;
+
+    pitch_detector_cleanup(&detector);
+    free(input);
+
+    const bool ok = valid && fabs(cents) <= PITCH_TOLERANCE_CENTS;
+    printf("pitch %7.2f Hz: detected %8.3f Hz (%+.3f cents)%s\n", freq, detected, cents,
+           ok ? "" : " FAILED");
+    return ok;
+}
+
+int main(void) {
+    bool ok = true;
+
+    for (uint32_t size = 2; size <= MAX_FFT_SIZE; size *= 2) {
+        ok = test_fft(size) && ok;
+    }
+
+    static const float yin_freqs[] = { 82.41f, 220.0f, 1760.0f };
+    for (size_t i = 0; i < sizeof(yin_freqs) / sizeof(yin_freqs[0]); i++) {
+        ok = test_difference_function(yin_freqs[i]) && ok;
+    }
+
+    // E2 to A6
+    static const float pitch_freqs[] = {
+        82.41f, 110.0f, 146.83f, 196.0f, 246.94f, 329.63f,
+        440.0f, 587.33f, 783.99f, 1046.5f, 1318.51f, 1760.0f
+    };
+    for (size_t i = 0; i < sizeof(pitch_freqs) / sizeof(pitch_freqs[0]); i++) {
+        ok = test_pitch(pitch_freqs[i]) && ok;
+    }
+
+    return ok ? 0 : 1;
+}
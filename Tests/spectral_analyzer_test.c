@@ -0,0 +1,93 @@
+/**
+ * @file spectral_analyzer_test.c
+ * @brief LR4 crossover tree recombines to an allpass
+ *
+ * The point of SPECTRAL_FILTER_LR4 is that the bands can be summed back:
+ * Σ_b H_b(z) is an allpass, so |Σ_b H_b| = 1 at every frequency. For 3, 5
+ * and 8 bands the impulse response of every band is rendered through the
+ * buffer path (spectral_analyzer_process_bands(), SIMD groups included),
+ * summed, and the magnitude of its spectrum compared with 1.
+ *
+ * The response must have decayed within RESPONSE_LENGTH samples for the
+ * FFT to see the whole filter; the lowest crossover rings longest.
+ *
+ * Crossovers span the processor's range (300 Hz - 3 kHz). The sections
+ * are designed in float, so the error grows as a crossover moves towards
+ * DC (about 4e-4 with a 100 Hz crossover).
+ */
+
+#include "SpectralAnalyzer.h"
+#include "fft.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_SAMPLE_RATE 48000.0f
+#define TEST_MIN_CROSSOVER 300.0f
+#define TEST_MAX_CROSSOVER 3000.0f
+
+#define RESPONSE_LENGTH 16384
+#define ALLPASS_TOLERANCE 1e-4f
+
+static bool test_allpass(uint32_t num_bands) {
+    static spectral_analyzer_t analyzer;
+    spectral_analyzer_init_bands(&analyzer, TEST_SAMPLE_RATE, num_bands,
+                                 TEST_MIN_CROSSOVER, TEST_MAX_CROSSOVER);
+    spectral_analyzer_set_crossovers(&analyzer, TEST_MIN_CROSSOVER, TEST_MAX_CROSSOVER,
+                                     SPECTRAL_FILTER_LR4);
+
+    float* impulse = calloc(RESPONSE_LENGTH, sizeof(float));
+    float* bands = malloc((size_t)num_bands * RESPONSE_LENGTH * sizeof(float));
+    float* outputs[SPECTRAL_MAX_BANDS];
+    for (uint32_t b = 0; b < num_bands; b++) {
+        outputs[b] = bands + (size_t)b * RESPONSE_LENGTH;
+    }
+    impulse[0] = 1.0f;
+
+    spectral_analyzer_process_bands(&analyzer, impulse, outputs, RESPONSE_LENGTH);
+
+    // Sum of the bands, as the spectrum's real part
+    float* re = calloc(RESPONSE_LENGTH, sizeof(float));
+    float* im = calloc(RESPONSE_LENGTH, sizeof(float));
+    for (uint32_t b = 0; b < num_bands; b++) {
+        for (uint32_t i = 0; i < RESPONSE_LENGTH; i++) {
+            re[i] += outputs[b][i];
+        }
+    }
+
+    fft_t fft;
+    fft_init(&fft, RESPONSE_LENGTH);
+    fft_forward(&fft, re, im);
+
+    float worst = 0.0f;
+    uint32_t worst_bin = 0;
+    for (uint32_t k = 0; k <= RESPONSE_LENGTH / 2; k++) {
+        const float error = fabsf(hypotf(re[k], im[k]) - 1.0f);
+        if (error > worst) {
+            worst = error;
+            worst_bin = k;
+        }
+    }
+
+    fft_cleanup(&fft);
+    free(impulse);
+    free(bands);
+    free(re);
+    free(im);
+
+    const bool ok = worst <= ALLPASS_TOLERANCE;
+    printf("LR4 %u bands: max ||H| - 1| %.3g at %.0f Hz%s\n", num_bands, worst,
+           worst_bin * TEST_SAMPLE_RATE / RESPONSE_LENGTH, ok ? "" : " FAILED");
+    return ok;
+}
+
+int main(void) {
+    static const uint32_t band_counts[] = { 3, 5, 8 };
+
+    bool ok = true;
+    for (size_t i = 0; i < sizeof(band_counts) / sizeof(band_counts[0]); i++) {
+        ok = test_allpass(band_counts[i]) && ok;
+    }
+    return ok ? 0 : 1;
+}
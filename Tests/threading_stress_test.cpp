@@ -0,0 +1,162 @@
+/**
+ * @file threading_stress_test.cpp
+ * @brief Cross-thread setters against a running audio thread
+ *
+ * Built with ThreadSanitizer when the compiler supports it (the DSP sources
+ * are compiled into a separate instrumented library for it), so a setter
+ * documented as safe while processing that touches audio thread state is
+ * reported as a data race. Without TSan it still checks that the calls
+ * complete and the output stays finite.
+ *
+ * - ResonantBodyProcessor with the pitch worker running: the audio thread
+ *   processes blocks while a control thread retunes the pitch hop
+ *   (resonant_body_set_pitch_hop())
+ * - effect engine: the audio thread renders while a control thread moves
+ *   the lookahead (modal_attractors_engine_set_lookahead()) and reads the
+ *   latency
+ */
+
+#include "ModalEffectAU.h"
+#include "ResonantBodyProcessor.h"
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+
+#define TEST_SAMPLE_RATE 48000.0f
+#define TEST_BLOCK_SIZE 128
+#define TEST_BLOCKS 1500                    // 4 s of audio per case
+
+typedef struct {
+    std::atomic<bool> done{false};
+    bool finite = true;
+} audio_state_t;
+
+// Sine with a slow glide, so the pitch tracker keeps publishing results
+static void fill_input(float* input, uint32_t block, double* phase) {
+    for (uint32_t i = 0; i < TEST_BLOCK_SIZE; i++) {
+        const double freq = 110.0 + 110.0 * sin(2.0 * M_PI * 0.25 * block * TEST_BLOCK_SIZE / TEST_SAMPLE_RATE);
+        *phase += 2.0 * M_PI * freq / TEST_SAMPLE_RATE;
+        input[i] = 0.5f * (float)sin(*phase);
+    }
+}
+
+static bool all_finite(const float* buffer, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        if (!std::isfinite(buffer[i])) return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// ResonantBodyProcessor: pitch hop retune with the worker running
+// ============================================================================
+
+typedef struct {
+    audio_state_t state;
+    resonant_body_processor_t* processor = nullptr;
+} body_test_t;
+
+static void body_audio_thread(body_test_t* test) {
+    float input[TEST_BLOCK_SIZE], output[TEST_BLOCK_SIZE];
+    double phase = 0.0;
+
+    test->state.finite = true;
+    for (uint32_t block = 0; block < TEST_BLOCKS; block++) {
+        fill_input(input, block, &phase);
+        resonant_body_process_block(test->processor, input, output, TEST_BLOCK_SIZE);
+        test->state.finite = test->state.finite && all_finite(output, TEST_BLOCK_SIZE);
+    }
+
+    test->state.done.store(true);
+}
+
+static bool test_body_pitch_hop(void) {
+    body_test_t test;
+    test.processor = new resonant_body_processor_t;
+    resonant_body_init(test.processor, TEST_SAMPLE_RATE);
+    resonant_body_set_engine(test.processor, RESONANT_BODY_ENGINE_FILTER);
+    resonant_body_set_morph(test.processor, 0.7f);
+
+    if (!resonant_body_set_pitch_worker(test.processor, true)) {
+        fprintf(stderr, "body: pitch worker did not start\n");
+        resonant_body_cleanup(test.processor);
+        delete test.processor;
+        return false;
+    }
+
+    std::thread audio(body_audio_thread, &test);
+
+    uint32_t retunes = 0;
+    while (!test.state.done.load()) {
+        resonant_body_set_pitch_hop(test.processor, 5.0f + (float)(retunes % 8) * 5.0f,
+                                    (retunes & 1) != 0);
+        retunes++;
+    }
+    audio.join();
+
+    resonant_body_set_pitch_worker(test.processor, false);
+    resonant_body_cleanup(test.processor);
+    delete test.processor;
+
+    printf("body: %u hop retunes while processing%s\n", retunes,
+           test.state.finite ? "" : ", output not finite");
+    return test.state.finite;
+}
+
+// ============================================================================
+// Effect engine: lookahead changes while rendering
+// ============================================================================
+
+typedef struct {
+    audio_state_t state;
+    ModalEffectEngine* engine = nullptr;
+} engine_test_t;
+
+static void engine_audio_thread(engine_test_t* test) {
+    float input[TEST_BLOCK_SIZE], outL[TEST_BLOCK_SIZE], outR[TEST_BLOCK_SIZE];
+    double phase = 0.0;
+
+    test->state.finite = true;
+    for (uint32_t block = 0; block < TEST_BLOCKS; block++) {
+        fill_input(input, block, &phase);
+        modal_attractors_engine_begin_events(test->engine);
+        modal_attractors_engine_process(test->engine, input, input, outL, outR, TEST_BLOCK_SIZE);
+        test->state.finite = test->state.finite &&
+                             all_finite(outL, TEST_BLOCK_SIZE) && all_finite(outR, TEST_BLOCK_SIZE);
+    }
+
+    test->state.done.store(true);
+}
+
+static bool test_engine_lookahead(void) {
+    engine_test_t test;
+    test.engine = new ModalEffectEngine;
+    modal_attractors_engine_init(test.engine, TEST_SAMPLE_RATE, TEST_BLOCK_SIZE, 5);
+
+    std::thread audio(engine_audio_thread, &test);
+
+    uint32_t changes = 0;
+    uint32_t max_latency = 0;
+    while (!test.state.done.load()) {
+        modal_attractors_engine_set_lookahead(test.engine, (float)(changes % 6) * 10.0f);
+        const uint32_t latency = modal_attractors_engine_get_latency(test.engine);
+        if (latency > max_latency) max_latency = latency;
+        changes++;
+    }
+    audio.join();
+
+    modal_attractors_engine_cleanup(test.engine);
+    delete test.engine;
+
+    printf("engine: %u lookahead changes while rendering, max latency %u%s\n",
+           changes, max_latency, test.state.finite ? "" : ", output not finite");
+    return test.state.finite;
+}
+
+int main(void) {
+    bool ok = true;
+    ok = test_body_pitch_hop() && ok;
+    ok = test_engine_lookahead() && ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,248 @@
+/**
+ * @file MidiFile.cpp
+ * @brief Standard MIDI File reader implementation
+ */
+
+#include "MidiFile.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+#define DEFAULT_TEMPO_US 500000     // 120 BPM until the first tempo event
+
+namespace {
+
+// Event on the merged tick timeline (tempo changes included)
+struct TickEvent {
+    uint64_t tick;
+    bool tempo;                 // Tempo change (us per quarter note in tempo_us)
+    uint32_t tempo_us;
+    midi_event_t event;         // Channel event (time filled in later)
+};
+
+// Bounds-checked big-endian reader over one chunk
+struct Reader {
+    const uint8_t* data;
+    size_t size;
+    size_t pos;
+    bool failed;
+
+    uint8_t byte() {
+        if (pos >= size) {
+            failed = true;
+            return 0;
+        }
+        return data[pos++];
+    }
+
+    uint32_t vlq() {
+        uint32_t value = 0;
+        for (int i = 0; i < 4; i++) {
+            uint8_t b = byte();
+            value = (value << 7) | (b & 0x7F);
+            if (!(b & 0x80)) return value;
+        }
+        failed = true;
+        return value;
+    }
+
+    void skip(uint32_t n) {
+        if (n > size - pos) {
+            failed = true;
+            pos = size;
+        } else {
+            pos += n;
+        }
+    }
+};
+
+uint32_t read_u32_be(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+}  // namespace
+
+// Parse one MTrk chunk onto the tick timeline
+static bool parse_track(const uint8_t* data, size_t size, std::vector<TickEvent>& out) {
+    Reader reader = { data, size, 0, false };
+    uint64_t tick = 0;
+    uint8_t running = 0;
+
+    while (reader.pos < reader.size && !reader.failed) {
+        tick += reader.vlq();
+
+        uint8_t status = reader.byte();
+        if (status < 0x80) {
+            // Running status: this byte is the first data byte
+            if (running == 0) return false;
+            reader.pos--;
+            status = running;
+        }
+
+        if (status == 0xFF) {
+            uint8_t type = reader.byte();
+            uint32_t length = reader.vlq();
+            if (type == 0x2F) break;  // End of track
+            if (type == 0x51 && length == 3 && reader.size - reader.pos >= 3) {
+                const uint8_t* p = reader.data + reader.pos;
+                TickEvent tempo = {};
+                tempo.tick = tick;
+                tempo.tempo = true;
+                tempo.tempo_us = ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+                out.push_back(tempo);
+            }
+            reader.skip(length);
+            continue;
+        }
+
+        if (status == 0xF0 || status == 0xF7) {
+            reader.skip(reader.vlq());  // SysEx
+            continue;
+        }
+
+        running = status;
+        const uint8_t kind = status & 0xF0;
+        const uint8_t channel = status & 0x0F;
+        const uint8_t d1 = reader.byte();
+        const uint8_t d2 = (kind == 0xC0 || kind == 0xD0) ? 0 : reader.byte();
+
+        TickEvent ev = {};
+        ev.tick = tick;
+        ev.event.channel = channel;
+        switch (kind) {
+            case 0x90:
+                if (d2 > 0) {
+                    ev.event.type = MIDI_EVENT_NOTE_ON;
+                    ev.event.note = d1 & 0x7F;
+                    ev.event.value = (float)d2 / 127.0f;
+                    out.push_back(ev);
+                    break;
+                }
+                [[fallthrough]];  // Velocity 0 = note off
+            case 0x80:
+                ev.event.type = MIDI_EVENT_NOTE_OFF;
+                ev.event.note = d1 & 0x7F;
+                out.push_back(ev);
+                break;
+            case 0xE0: {
+                int bend = (((int)d2 & 0x7F) << 7 | (d1 & 0x7F)) - 8192;
+                ev.event.type = MIDI_EVENT_PITCH_BEND;
+                ev.event.value = (float)bend / 8192.0f;
+                out.push_back(ev);
+                break;
+            }
+            default:
+                break;  // Aftertouch, controllers, program changes
+        }
+    }
+
+    return !reader.failed;
+}
+
+bool midi_read(const char* path, midi_file_t* midi) {
+    if (!path || !midi) return false;
+    memset(midi, 0, sizeof(*midi));
+
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+    std::vector<uint8_t> bytes;
+    uint8_t buffer[4096];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        bytes.insert(bytes.end(), buffer, buffer + n);
+    }
+    fclose(file);
+
+    if (bytes.size() < 14 || memcmp(bytes.data(), "MThd", 4) != 0 ||
+        read_u32_be(bytes.data() + 4) < 6) {
+        fprintf(stderr, "%s: not a Standard MIDI File\n", path);
+        return false;
+    }
+
+    const uint8_t* header = bytes.data() + 8;
+    const uint32_t format = ((uint32_t)header[0] << 8) | header[1];
+    const uint32_t division = ((uint32_t)header[4] << 8) | header[5];
+    if (format > 1) {
+        fprintf(stderr, "%s: format %u files are not supported\n", path, format);
+        return false;
+    }
+
+    // Collect every track onto one tick timeline
+    std::vector<TickEvent> timeline;
+    size_t pos = 8 + read_u32_be(bytes.data() + 4);
+    while (pos + 8 <= bytes.size()) {
+        const uint32_t length = read_u32_be(bytes.data() + pos + 4);
+        const size_t available = bytes.size() - pos - 8;
+        const size_t chunk_size = (length < available) ? length : available;
+
+        if (memcmp(bytes.data() + pos, "MTrk", 4) == 0 &&
+            !parse_track(bytes.data() + pos + 8, chunk_size, timeline)) {
+            fprintf(stderr, "%s: malformed track (events after the error are dropped)\n", path);
+        }
+        pos += 8 + chunk_size;
+    }
+
+    // Stable: simultaneous events keep their track order
+    std::stable_sort(timeline.begin(), timeline.end(),
+                     [](const TickEvent& a, const TickEvent& b) { return a.tick < b.tick; });
+
+    // Ticks to seconds: PPQ follows the tempo map, SMPTE is fixed
+    const bool smpte = (division & 0x8000) != 0;
+    const double ticks_per_second = smpte
+        ? (double)(-(int8_t)(division >> 8)) * (double)(division & 0xFF)
+        : 0.0;
+    if (division == 0 || (smpte && ticks_per_second <= 0.0)) {
+        fprintf(stderr, "%s: invalid time division\n", path);
+        return false;
+    }
+    const double smpte_tick_seconds = smpte ? 1.0 / ticks_per_second : 0.0;
+    const double ppq = smpte ? 1.0 : (double)division;
+
+    std::vector<midi_event_t> events;
+    events.reserve(timeline.size());
+    double tempo_us = DEFAULT_TEMPO_US;
+    uint64_t last_tick = 0;
+    double last_time = 0.0;
+    for (const TickEvent& ev : timeline) {
+        const double time = smpte
+            ? (double)ev.tick * smpte_tick_seconds
+            : last_time + (double)(ev.tick - last_tick) * tempo_us * 1e-6 / ppq;
+        last_tick = ev.tick;
+        last_time = time;
+
+        if (ev.tempo) {
+            if (ev.tempo_us > 0) tempo_us = ev.tempo_us;
+            continue;
+        }
+
+        midi_event_t out = ev.event;
+        out.time = time;
+        events.push_back(out);
+    }
+
+    midi->num_events = (uint32_t)events.size();
+    midi->events = (midi_event_t*)malloc((events.size() + 1) * sizeof(midi_event_t));
+    if (!midi->events) {
+        midi->num_events = 0;
+        return false;
+    }
+    if (!events.empty()) {
+        memcpy(midi->events, events.data(), events.size() * sizeof(midi_event_t));
+        midi->duration = events.back().time;
+    }
+
+    return true;
+}
+
+void midi_free(midi_file_t* midi) {
+    if (!midi) return;
+
+    free(midi->events);
+    midi->events = NULL;
+    midi->num_events = 0;
+}
@@ -0,0 +1,62 @@
+/**
+ * @file MidiFile.h
+ * @brief Standard MIDI File reader for the offline renderer
+ *
+ * Reads format 0 and 1 files (PPQ or SMPTE time division), merges the
+ * tracks and converts event times to seconds through the tempo map. Only
+ * the events the synth path understands are kept: note on/off and pitch
+ * bend.
+ */
+
+#ifndef MIDI_FILE_H
+#define MIDI_FILE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Kept event types
+ */
+typedef enum {
+    MIDI_EVENT_NOTE_ON = 0,     ///< value = velocity [0, 1]
+    MIDI_EVENT_NOTE_OFF,        ///< value unused
+    MIDI_EVENT_PITCH_BEND       ///< value = bend [-1, 1]
+} midi_event_type_t;
+
+/**
+ * @brief Timed event
+ */
+typedef struct {
+    double time;                ///< Seconds from the start of the file
+    midi_event_type_t type;     ///< Event type
+    uint8_t channel;            ///< MIDI channel (0-15)
+    uint8_t note;               ///< Note number (note events)
+    float value;                ///< Velocity or bend
+} midi_event_t;
+
+/**
+ * @brief Decoded file
+ */
+typedef struct {
+    midi_event_t* events;       ///< Events in time order
+    uint32_t num_events;        ///< Event count
+    double duration;            ///< Time of the last event (seconds)
+} midi_file_t;
+
+/**
+ * @brief Read a Standard MIDI File
+ *
+ * @param path File path
+ * @param midi Receives the events (free with midi_free())
+ * @return True on success; on failure a message is printed to stderr
+ */
+bool midi_read(const char* path, midi_file_t* midi);
+
+/**
+ * @brief Free decoded events
+ *
+ * @param midi File filled by midi_read()
+ */
+void midi_free(midi_file_t* midi);
+
+#endif // MIDI_FILE_H
@@ -0,0 +1,199 @@
+/**
+ * @file WavFile.cpp
+ * @brief Minimal RIFF/WAVE reader and writer implementation
+ */
+
+#include "WavFile.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WAVE_FORMAT_PCM 0x0001
+#define WAVE_FORMAT_IEEE_FLOAT 0x0003
+#define WAVE_FORMAT_EXTENSIBLE 0xFFFE
+
+// Little-endian field access (independent of the host byte order)
+static uint32_t read_u16(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+static uint32_t read_u32(const uint8_t* p) {
+    return read_u16(p) | (read_u16(p + 2) << 16);
+}
+
+static void write_u16(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void write_u32(uint8_t* p, uint32_t v) {
+    write_u16(p, v);
+    write_u16(p + 2, v >> 16);
+}
+
+// One sample of the given encoding as a float in [-1, 1]
+static float decode_sample(const uint8_t* p, uint32_t format, uint32_t bits) {
+    if (format == WAVE_FORMAT_IEEE_FLOAT) {
+        if (bits == 64) {
+            double d;
+            uint64_t u = (uint64_t)read_u32(p) | ((uint64_t)read_u32(p + 4) << 32);
+            memcpy(&d, &u, sizeof(d));
+            return (float)d;
+        }
+        float f;
+        uint32_t u = read_u32(p);
+        memcpy(&f, &u, sizeof(f));
+        return f;
+    }
+
+    switch (bits) {
+        case 8:
+            return ((float)p[0] - 128.0f) / 128.0f;  // 8-bit PCM is unsigned
+        case 16:
+            return (float)(int16_t)read_u16(p) / 32768.0f;
+        case 24: {
+            int32_t v = (int32_t)(read_u16(p) << 8 | (uint32_t)p[2] << 24) >> 8;
+            return (float)v / 8388608.0f;
+        }
+        default:
+            return (float)((double)(int32_t)read_u32(p) / 2147483648.0);
+    }
+}
+
+bool wav_read(const char* path, wav_file_t* wav) {
+    if (!path || !wav) return false;
+    memset(wav, 0, sizeof(*wav));
+
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+
+    uint8_t header[12];
+    if (fread(header, 1, sizeof(header), file) != sizeof(header) ||
+        memcmp(header, "RIFF", 4) != 0 || memcmp(header + 8, "WAVE", 4) != 0) {
+        fprintf(stderr, "%s: not a RIFF/WAVE file\n", path);
+        fclose(file);
+        return false;
+    }
+
+    // Walk the chunks for "fmt " and "data"
+    uint32_t format = 0, channels = 0, rate = 0, bits = 0;
+    uint8_t* data = NULL;
+    uint32_t data_size = 0;
+    uint8_t chunk[8];
+    while (fread(chunk, 1, sizeof(chunk), file) == sizeof(chunk)) {
+        uint32_t size = read_u32(chunk + 4);
+
+        if (memcmp(chunk, "fmt ", 4) == 0 && size >= 16) {
+            uint8_t fmt[40] = {0};
+            uint32_t keep = (size < sizeof(fmt)) ? size : (uint32_t)sizeof(fmt);
+            if (fread(fmt, 1, keep, file) != keep) break;
+            fseek(file, (long)(size - keep + (size & 1)), SEEK_CUR);
+
+            format = read_u16(fmt);
+            channels = read_u16(fmt + 2);
+            rate = read_u32(fmt + 4);
+            bits = read_u16(fmt + 14);
+            if (format == WAVE_FORMAT_EXTENSIBLE && keep >= 26) {
+                format = read_u16(fmt + 24);  // Sub-format GUID starts with the tag
+            }
+        } else if (memcmp(chunk, "data", 4) == 0) {
+            data = (uint8_t*)malloc(size ? size : 1);
+            if (!data) break;
+            data_size = (uint32_t)fread(data, 1, size, file);  // Tolerate truncation
+            break;
+        } else {
+            fseek(file, (long)(size + (size & 1)), SEEK_CUR);
+        }
+    }
+    fclose(file);
+
+    const bool supported =
+        (format == WAVE_FORMAT_PCM && (bits == 8 || bits == 16 || bits == 24 || bits == 32)) ||
+        (format == WAVE_FORMAT_IEEE_FLOAT && (bits == 32 || bits == 64));
+    if (!data || channels == 0 || rate == 0 || !supported) {
+        fprintf(stderr, "%s: unsupported or missing format/data (format %u, %u bits)\n",
+                path, format, bits);
+        free(data);
+        return false;
+    }
+
+    const uint32_t bytes = bits / 8;
+    wav->sample_rate = rate;
+    wav->num_channels = channels;
+    wav->num_frames = data_size / (bytes * channels);
+    wav->samples = (float*)malloc((size_t)wav->num_frames * channels * sizeof(float) + 1);
+    if (!wav->samples) {
+        free(data);
+        return false;
+    }
+
+    const size_t count = (size_t)wav->num_frames * channels;
+    for (size_t i = 0; i < count; i++) {
+        wav->samples[i] = decode_sample(data + i * bytes, format, bits);
+    }
+
+    free(data);
+    return true;
+}
+
+bool wav_write(const char* path,
+               const float* samples,
+               uint32_t num_frames,
+               uint32_t num_channels,
+               uint32_t sample_rate) {
+    if (!path || !samples || num_channels == 0) return false;
+
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        fprintf(stderr, "%s: cannot create\n", path);
+        return false;
+    }
+
+    const uint32_t data_size = num_frames * num_channels * 4;
+    uint8_t header[44];
+    memcpy(header, "RIFF", 4);
+    write_u32(header + 4, 36 + data_size);
+    memcpy(header + 8, "WAVE", 4);
+    memcpy(header + 12, "fmt ", 4);
+    write_u32(header + 16, 16);
+    write_u16(header + 20, WAVE_FORMAT_IEEE_FLOAT);
+    write_u16(header + 22, num_channels);
+    write_u32(header + 24, sample_rate);
+    write_u32(header + 28, sample_rate * num_channels * 4);
+    write_u16(header + 32, num_channels * 4);
+    write_u16(header + 34, 32);
+    memcpy(header + 36, "data", 4);
+    write_u32(header + 40, data_size);
+
+    bool ok = (fwrite(header, 1, sizeof(header), file) == sizeof(header));
+
+    // Little-endian sample bytes, a block at a time
+    uint8_t block[4096];
+    const size_t count = (size_t)num_frames * num_channels;
+    for (size_t i = 0; ok && i < count; ) {
+        size_t n = 0;
+        for (; n < sizeof(block) / 4 && i < count; n++, i++) {
+            uint32_t u;
+            memcpy(&u, &samples[i], sizeof(u));
+            write_u32(block + n * 4, u);
+        }
+        ok = (fwrite(block, 4, n, file) == n);
+    }
+
+    if (fclose(file) != 0) ok = false;
+    if (!ok) {
+        fprintf(stderr, "%s: write failed\n", path);
+    }
+    return ok;
+}
+
+void wav_free(wav_file_t* wav) {
+    if (!wav) return;
+
+    free(wav->samples);
+    wav->samples = NULL;
+    wav->num_frames = 0;
+}
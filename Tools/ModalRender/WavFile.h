@@ -0,0 +1,58 @@
+/**
+ * @file WavFile.h
+ * @brief Minimal RIFF/WAVE reader and writer for the offline renderer
+ *
+ * Reads PCM (8/16/24/32-bit), IEEE float (32/64-bit) and
+ * WAVE_FORMAT_EXTENSIBLE files into interleaved floats; writes 32-bit
+ * float files.
+ */
+
+#ifndef WAV_FILE_H
+#define WAV_FILE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Decoded audio
+ */
+typedef struct {
+    uint32_t sample_rate;       ///< Sample rate in Hz
+    uint32_t num_channels;      ///< Channel count
+    uint32_t num_frames;        ///< Frames per channel
+    float* samples;             ///< Interleaved samples [-1, 1]
+} wav_file_t;
+
+/**
+ * @brief Read a WAV file
+ *
+ * @param path File path
+ * @param wav Receives the decoded audio (free with wav_free())
+ * @return True on success; on failure a message is printed to stderr
+ */
+bool wav_read(const char* path, wav_file_t* wav);
+
+/**
+ * @brief Write a 32-bit float WAV file
+ *
+ * @param path File path
+ * @param samples Interleaved samples
+ * @param num_frames Frames per channel
+ * @param num_channels Channel count
+ * @param sample_rate Sample rate in Hz
+ * @return True on success; on failure a message is printed to stderr
+ */
+bool wav_write(const char* path,
+               const float* samples,
+               uint32_t num_frames,
+               uint32_t num_channels,
+               uint32_t sample_rate);
+
+/**
+ * @brief Free decoded audio
+ *
+ * @param wav Audio filled by wav_read()
+ */
+void wav_free(wav_file_t* wav);
+
+#endif // WAV_FILE_H
@@ -0,0 +1,580 @@
+/**
+ * @file main.cpp
+ * @brief modal_render - offline renderer and benchmark for the DSP engine
+ *
+ * Drives the same C API as the Audio Unit (ModalEffectAU.h) without a host:
+ * - WAV input runs through modal_attractors_engine_process() (effect path)
+ * - MIDI input runs through modal_attractors_engine_render() (synth path),
+ *   events placed at their sample offsets inside each block
+ * - with --body, the input (or with --burst a noise burst instead) runs
+ *   through resonant_body_process_block() of a bare ResonantBodyProcessor
+ *   with the modal or the filter engine (body path)
+ *
+ * The output is written as a 32-bit float stereo WAV, aligned with the
+ * input (lookahead latency is compensated the way a host would). With
+ * --bench the CPU time of every block is measured and reported per second
+ * of rendered audio, so load over a long decay tail (--tail) can be
+ * checked for flatness.
+ */
+
+#include "ModalEffectAU.h"
+#include "ResonantBodyProcessor.h"
+#include "MidiFile.h"
+#include "WavFile.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#define DEFAULT_SAMPLE_RATE 48000
+#define DEFAULT_BLOCK_SIZE 512
+#define MAX_BLOCK_SIZE 2048         // NodeManager's render buffer
+#define DEFAULT_TAIL_SECONDS 2.0
+
+// Effect parameters by name (ids match ModalEffectExtensionParameterAddresses.h)
+static const struct {
+    const char* name;
+    uint32_t id;
+} PARAMETER_NAMES[] = {
+    { "body", 0 },
+    { "material", 1 },
+    { "excite", 2 },
+    { "morph", 3 },
+    { "mix", 4 },
+};
+
+static const struct {
+    const char* name;
+    modal_onset_routing_t routing;
+} ROUTING_NAMES[] = {
+    { "single", MODAL_ONSET_ROUTING_SINGLE },
+    { "round-robin", MODAL_ONSET_ROUTING_ROUND_ROBIN },
+    { "zones", MODAL_ONSET_ROUTING_PITCH_ZONES },
+    { "band", MODAL_ONSET_ROUTING_PER_BAND },
+};
+
+static const struct {
+    const char* name;
+    resonant_body_engine_t engine;
+} BODY_ENGINE_NAMES[] = {
+    { "modal", RESONANT_BODY_ENGINE_MODAL },
+    { "filter", RESONANT_BODY_ENGINE_FILTER },
+};
+
+#define MAX_PARAMETER_SETTINGS 16
+
+typedef struct {
+    const char* input_path;
+    const char* output_path;
+    uint32_t block_size;
+    uint32_t sample_rate;           // MIDI and --burst input only
+    double tail_seconds;
+    float lookahead_ms;
+    double control_rate_hz;         // 0 = engine default
+    bool interpolate;               // Linear amplitude ramps per control tick
+    modal_onset_routing_t routing;
+    bool body;                      // Body path instead of the engine
+    resonant_body_engine_t body_engine;
+    double burst_ms;                // Noise burst instead of an input (body path, 0 = off)
+    uint32_t num_parameters;
+    uint32_t parameter_ids[MAX_PARAMETER_SETTINGS];
+    float parameter_values[MAX_PARAMETER_SETTINGS];
+    bool bench;
+} render_options_t;
+
+// CPU time per second of rendered audio
+typedef struct {
+    std::vector<double> seconds;    // Seconds of CPU per output second
+    double total;                   // Total CPU seconds
+    double worst_block;             // Longest block (seconds)
+} bench_stats_t;
+
+static void print_usage(const char* program) {
+    fprintf(stderr,
+            "usage: %s [options] <input.wav|input.mid> [output.wav]\n"
+            "       %s --body ENGINE --burst MS [options] [output.wav]\n"
+            "\n"
+            "  --block N          frames per render call (default %d, max %d)\n"
+            "  --rate HZ          sample rate for MIDI or --burst input (default %d)\n"
+            "  --tail SEC         silence rendered after the input (default %.0f)\n"
+            "  --param NAME=V     body, material, excite, morph or mix in [0, 1]\n"
+            "  --lookahead MS     onset lookahead (effect path)\n"
+            "  --routing MODE     single, round-robin, zones or band (effect path)\n"
+            "  --control-rate HZ  node network control rate (default 500)\n"
+            "  --interpolate      ramp mode amplitudes linearly across control ticks\n"
+            "  --body ENGINE      ResonantBodyProcessor with the modal or filter engine\n"
+            "  --burst MS         noise burst instead of an input file (with --body)\n"
+            "  --bench            report CPU load per second of audio\n"
+            "\n"
+            "The output may be omitted with --bench.\n",
+            program, program, DEFAULT_BLOCK_SIZE, MAX_BLOCK_SIZE, DEFAULT_SAMPLE_RATE,
+            DEFAULT_TAIL_SECONDS);
+}
+
+static bool parse_parameter(const char* arg, render_options_t* options) {
+    const char* equals = strchr(arg, '=');
+    if (!equals || options->num_parameters >= MAX_PARAMETER_SETTINGS) return false;
+
+    const size_t length = (size_t)(equals - arg);
+    for (const auto& entry : PARAMETER_NAMES) {
+        if (strlen(entry.name) == length && strncmp(arg, entry.name, length) == 0) {
+            options->parameter_ids[options->num_parameters] = entry.id;
+            options->parameter_values[options->num_parameters] = strtof(equals + 1, NULL);
+            options->num_parameters++;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool parse_routing(const char* arg, render_options_t* options) {
+    for (const auto& entry : ROUTING_NAMES) {
+        if (strcmp(arg, entry.name) == 0) {
+            options->routing = entry.routing;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool parse_body_engine(const char* arg, render_options_t* options) {
+    for (const auto& entry : BODY_ENGINE_NAMES) {
+        if (strcmp(arg, entry.name) == 0) {
+            options->body = true;
+            options->body_engine = entry.engine;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool parse_options(int argc, char** argv, render_options_t* options) {
+    memset(options, 0, sizeof(*options));
+    options->block_size = DEFAULT_BLOCK_SIZE;
+    options->sample_rate = DEFAULT_SAMPLE_RATE;
+    options->tail_seconds = DEFAULT_TAIL_SECONDS;
+    options->routing = MODAL_ONSET_ROUTING_SINGLE;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const bool has_value = (i + 1 < argc);
+
+        if (strcmp(arg, "--bench") == 0) {
+            options->bench = true;
+        } else if (strcmp(arg, "--interpolate") == 0) {
+            options->interpolate = true;
+        } else if (strcmp(arg, "--control-rate") == 0 && has_value) {
+            options->control_rate_hz = strtod(argv[++i], NULL);
+        } else if (strcmp(arg, "--block") == 0 && has_value) {
+            options->block_size = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(arg, "--rate") == 0 && has_value) {
+            options->sample_rate = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(arg, "--tail") == 0 && has_value) {
+            options->tail_seconds = strtod(argv[++i], NULL);
+        } else if (strcmp(arg, "--lookahead") == 0 && has_value) {
+            options->lookahead_ms = strtof(argv[++i], NULL);
+        } else if (strcmp(arg, "--param") == 0 && has_value) {
+            if (!parse_parameter(argv[++i], options)) {
+                fprintf(stderr, "unknown parameter setting: %s\n", argv[i]);
+                return false;
+            }
+        } else if (strcmp(arg, "--routing") == 0 && has_value) {
+            if (!parse_routing(argv[++i], options)) {
+                fprintf(stderr, "unknown routing: %s\n", argv[i]);
+                return false;
+            }
+        } else if (strcmp(arg, "--body") == 0 && has_value) {
+            if (!parse_body_engine(argv[++i], options)) {
+                fprintf(stderr, "unknown body engine: %s\n", argv[i]);
+                return false;
+            }
+        } else if (strcmp(arg, "--burst") == 0 && has_value) {
+            options->burst_ms = strtod(argv[++i], NULL);
+        } else if (arg[0] == '-' && arg[1] == '-') {
+            fprintf(stderr, "unknown option: %s\n", arg);
+            return false;
+        } else if (!options->input_path) {
+            options->input_path = arg;
+        } else if (!options->output_path) {
+            options->output_path = arg;
+        } else {
+            return false;
+        }
+    }
+
+    if (options->block_size < 1 || options->block_size > MAX_BLOCK_SIZE) {
+        fprintf(stderr, "block size must be 1-%d\n", MAX_BLOCK_SIZE);
+        return false;
+    }
+    if (options->sample_rate < 8000) {
+        fprintf(stderr, "sample rate too low\n");
+        return false;
+    }
+    if (options->tail_seconds < 0.0) {
+        options->tail_seconds = 0.0;
+    }
+    if (options->control_rate_hz < 0.0) {
+        fprintf(stderr, "control rate must be positive\n");
+        return false;
+    }
+
+    if (options->burst_ms < 0.0) {
+        fprintf(stderr, "burst length must be positive\n");
+        return false;
+    }
+
+    // The burst replaces the input file, so the only path is the output
+    if (options->burst_ms > 0.0) {
+        if (!options->body) {
+            fprintf(stderr, "--burst needs --body\n");
+            return false;
+        }
+        if (options->output_path) {
+            fprintf(stderr, "--burst takes no input file\n");
+            return false;
+        }
+        options->output_path = options->input_path;
+        options->input_path = NULL;
+        return options->output_path || options->bench;
+    }
+
+    return options->input_path && (options->output_path || options->bench);
+}
+
+// Standard MIDI Files start with "MThd", everything else is read as WAV
+static bool is_midi_file(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (!file) return false;
+
+    char magic[4] = {0};
+    size_t n = fread(magic, 1, sizeof(magic), file);
+    fclose(file);
+    return n == sizeof(magic) && memcmp(magic, "MThd", 4) == 0;
+}
+
+static void init_engine(ModalEffectEngine* engine,
+                        const render_options_t* options,
+                        uint32_t sample_rate) {
+    modal_attractors_engine_init(engine, (double)sample_rate, options->block_size, 5);
+
+    for (uint32_t i = 0; i < options->num_parameters; i++) {
+        modal_attractors_engine_set_parameter(engine, options->parameter_ids[i],
+                                              options->parameter_values[i]);
+    }
+    modal_attractors_engine_set_lookahead(engine, options->lookahead_ms);
+    modal_attractors_engine_set_onset_routing(engine, options->routing);
+    if (options->control_rate_hz > 0.0) {
+        modal_attractors_engine_set_control_rate(engine, options->control_rate_hz);
+    }
+    modal_attractors_engine_set_amplitude_interpolation(engine, options->interpolate);
+
+    printf("control rate %.0f Hz, %s amplitudes\n",
+           modal_attractors_engine_get_control_rate(engine),
+           options->interpolate ? "interpolated" : "smoothed");
+}
+
+static void bench_record(bench_stats_t* stats,
+                         std::chrono::steady_clock::time_point start,
+                         uint64_t frame,
+                         uint32_t sample_rate) {
+    const double elapsed = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+
+    const size_t second = (size_t)(frame / sample_rate);
+    if (stats->seconds.size() <= second) {
+        stats->seconds.resize(second + 1, 0.0);
+    }
+    stats->seconds[second] += elapsed;
+    stats->total += elapsed;
+    if (elapsed > stats->worst_block) {
+        stats->worst_block = elapsed;
+    }
+}
+
+static void bench_report(const bench_stats_t* stats,
+                         uint64_t num_frames,
+                         uint32_t sample_rate,
+                         uint32_t block_size) {
+    const double audio_seconds = (double)num_frames / (double)sample_rate;
+    const double block_budget = (double)block_size / (double)sample_rate;
+
+    printf("second   cpu ms   load %%\n");
+    for (size_t s = 0; s < stats->seconds.size(); s++) {
+        // The last bucket may cover less than a second of audio
+        double covered = audio_seconds - (double)s;
+        if (covered > 1.0) covered = 1.0;
+        printf("%6zu %8.2f %8.3f\n", s, stats->seconds[s] * 1e3,
+               (covered > 0.0) ? 100.0 * stats->seconds[s] / covered : 0.0);
+    }
+    printf("total: %.3f s of audio in %.3f s of CPU (%.1fx realtime)\n",
+           audio_seconds, stats->total,
+           (stats->total > 0.0) ? audio_seconds / stats->total : 0.0);
+    printf("worst block: %.1f us of a %.1f us budget\n",
+           stats->worst_block * 1e6, block_budget * 1e6);
+}
+
+static void print_levels(const std::vector<float>& output) {
+    double sum = 0.0;
+    float peak = 0.0f;
+    for (float x : output) {
+        sum += (double)x * x;
+        peak = fmaxf(peak, fabsf(x));
+    }
+    const double rms = output.empty() ? 0.0 : sqrt(sum / (double)output.size());
+    printf("output peak %.2f dBFS, rms %.2f dBFS\n",
+           20.0 * log10(fmax(peak, 1e-12)), 20.0 * log10(fmax(rms, 1e-12)));
+}
+
+/**
+ * Effect path: the input file (first two channels, mono duplicated) through
+ * modal_attractors_engine_process(), followed by the tail.
+ */
+static bool render_effect(const render_options_t* options,
+                          std::vector<float>& output,
+                          uint32_t* sample_rate,
+                          bench_stats_t* stats) {
+    wav_file_t wav;
+    if (!wav_read(options->input_path, &wav)) return false;
+
+    ModalEffectEngine* engine = new ModalEffectEngine;
+    init_engine(engine, options, wav.sample_rate);
+
+    // Render the latency past the end and drop it from the front
+    const uint32_t latency = modal_attractors_engine_get_latency(engine);
+    const uint64_t tail = (uint64_t)(options->tail_seconds * wav.sample_rate);
+    const uint64_t total = (uint64_t)wav.num_frames + tail + latency;
+    const uint32_t block = options->block_size;
+    const uint32_t channels = wav.num_channels;
+
+    std::vector<float> inL(block), inR(block), outL(block), outR(block);
+    output.assign((size_t)(total - latency) * 2, 0.0f);
+
+    for (uint64_t frame = 0; frame < total; frame += block) {
+        const uint32_t n = (uint32_t)((total - frame < block) ? total - frame : block);
+
+        for (uint32_t i = 0; i < n; i++) {
+            const uint64_t src = frame + i;
+            if (src < wav.num_frames) {
+                const float* s = wav.samples + src * channels;
+                inL[i] = s[0];
+                inR[i] = (channels > 1) ? s[1] : s[0];
+            } else {
+                inL[i] = inR[i] = 0.0f;
+            }
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        modal_attractors_engine_begin_events(engine);
+        modal_attractors_engine_process(engine, inL.data(), inR.data(),
+                                        outL.data(), outR.data(), n);
+        if (options->bench) {
+            bench_record(stats, start, frame, wav.sample_rate);
+        }
+
+        for (uint32_t i = 0; i < n; i++) {
+            if (frame + i < latency) continue;
+            const size_t dst = (size_t)(frame + i - latency) * 2;
+            output[dst] = outL[i];
+            output[dst + 1] = outR[i];
+        }
+    }
+
+    printf("effect: %s, %u Hz, %u ch, %u frames, latency %u\n", options->input_path,
+           wav.sample_rate, channels, wav.num_frames, latency);
+
+    *sample_rate = wav.sample_rate;
+    modal_attractors_engine_cleanup(engine);
+    delete engine;
+    wav_free(&wav);
+    return true;
+}
+
+/**
+ * Synth path: the MIDI events through modal_attractors_engine_render(),
+ * each pushed at its offset inside the block that contains it.
+ */
+static bool render_synth(const render_options_t* options,
+                         std::vector<float>& output,
+                         uint32_t* sample_rate,
+                         bench_stats_t* stats) {
+    midi_file_t midi;
+    if (!midi_read(options->input_path, &midi)) return false;
+
+    const uint32_t rate = options->sample_rate;
+    ModalEffectEngine* engine = new ModalEffectEngine;
+    init_engine(engine, options, rate);
+
+    const uint64_t total = (uint64_t)((midi.duration + options->tail_seconds) * rate) + 1;
+    const uint32_t block = options->block_size;
+
+    std::vector<float> outL(block), outR(block);
+    output.assign((size_t)total * 2, 0.0f);
+
+    uint32_t next_event = 0;
+    for (uint64_t frame = 0; frame < total; frame += block) {
+        const uint32_t n = (uint32_t)((total - frame < block) ? total - frame : block);
+
+        const auto start = std::chrono::steady_clock::now();
+        modal_attractors_engine_begin_events(engine);
+        while (next_event < midi.num_events) {
+            const midi_event_t* ev = &midi.events[next_event];
+            const uint64_t at = (uint64_t)(ev->time * rate + 0.5);
+            if (at >= frame + n) break;
+
+            const int32_t offset = (int32_t)(at - frame);
+            switch (ev->type) {
+                case MIDI_EVENT_NOTE_ON:
+                    modal_attractors_engine_push_note_on(engine, offset, ev->note,
+                                                         ev->value, ev->channel);
+                    break;
+                case MIDI_EVENT_NOTE_OFF:
+                    modal_attractors_engine_push_note_off(engine, offset, ev->note);
+                    break;
+                case MIDI_EVENT_PITCH_BEND:
+                    modal_attractors_engine_push_pitch_bend(engine, offset, ev->value);
+                    break;
+            }
+            next_event++;
+        }
+        modal_attractors_engine_render(engine, outL.data(), outR.data(), n);
+        if (options->bench) {
+            bench_record(stats, start, frame, rate);
+        }
+
+        for (uint32_t i = 0; i < n; i++) {
+            output[(size_t)(frame + i) * 2] = outL[i];
+            output[(size_t)(frame + i) * 2 + 1] = outR[i];
+        }
+    }
+
+    printf("synth: %s, %u events, %.2f s, rendered at %u Hz\n", options->input_path,
+           midi.num_events, midi.duration, rate);
+
+    *sample_rate = rate;
+    modal_attractors_engine_cleanup(engine);
+    delete engine;
+    midi_free(&midi);
+    return true;
+}
+
+/**
+ * Body path: the input file (first channel) or the --burst noise through
+ * resonant_body_process_block(), followed by the tail. The processor has
+ * no lookahead, so there is no latency to compensate.
+ */
+static bool render_body(const render_options_t* options,
+                        std::vector<float>& output,
+                        uint32_t* sample_rate,
+                        bench_stats_t* stats) {
+    wav_file_t wav = {};
+    if (options->input_path) {
+        if (!wav_read(options->input_path, &wav)) return false;
+    }
+
+    const uint32_t rate = options->input_path ? wav.sample_rate : options->sample_rate;
+    const uint64_t input_frames = options->input_path
+                                ? wav.num_frames
+                                : (uint64_t)(options->burst_ms * 0.001 * rate);
+
+    resonant_body_processor_t* processor = new resonant_body_processor_t;
+    resonant_body_init(processor, (float)rate);
+    resonant_body_set_engine(processor, options->body_engine);
+
+    for (uint32_t i = 0; i < options->num_parameters; i++) {
+        const float value = options->parameter_values[i];
+        switch (options->parameter_ids[i]) {
+            case 0: resonant_body_set_body_size(processor, value); break;
+            case 1: resonant_body_set_material(processor, value); break;
+            case 2: resonant_body_set_excite(processor, value); break;
+            case 3: resonant_body_set_morph(processor, value); break;
+            case 4: resonant_body_set_mix(processor, value); break;
+        }
+    }
+
+    const uint64_t total = input_frames + (uint64_t)(options->tail_seconds * rate);
+    const uint32_t block = options->block_size;
+
+    std::vector<float> in(block), out(block);
+    output.assign((size_t)total * 2, 0.0f);
+
+    uint32_t noise = 0x2545F491u;
+    for (uint64_t frame = 0; frame < total; frame += block) {
+        const uint32_t n = (uint32_t)((total - frame < block) ? total - frame : block);
+
+        for (uint32_t i = 0; i < n; i++) {
+            const uint64_t src = frame + i;
+            if (src >= input_frames) {
+                in[i] = 0.0f;
+            } else if (options->input_path) {
+                in[i] = wav.samples[src * wav.num_channels];
+            } else {
+                // xorshift32 white noise at -6 dBFS peak
+                noise ^= noise << 13;
+                noise ^= noise >> 17;
+                noise ^= noise << 5;
+                in[i] = (float)(noise >> 8) * (1.0f / 16777216.0f) - 0.5f;
+            }
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        resonant_body_process_block(processor, in.data(), out.data(), n);
+        if (options->bench) {
+            bench_record(stats, start, frame, rate);
+        }
+
+        for (uint32_t i = 0; i < n; i++) {
+            output[(size_t)(frame + i) * 2] = out[i];
+            output[(size_t)(frame + i) * 2 + 1] = out[i];
+        }
+    }
+
+    printf("body: %s engine, %s, %u Hz, %llu input frames\n",
+           (options->body_engine == RESONANT_BODY_ENGINE_FILTER) ? "filter" : "modal",
+           options->input_path ? options->input_path : "noise burst",
+           rate, (unsigned long long)input_frames);
+
+    *sample_rate = rate;
+    resonant_body_cleanup(processor);
+    delete processor;
+    if (options->input_path) {
+        wav_free(&wav);
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    render_options_t options;
+    if (!parse_options(argc, argv, &options)) {
+        print_usage(argv[0]);
+        return 2;
+    }
+
+    std::vector<float> output;
+    uint32_t sample_rate = 0;
+    bench_stats_t stats = {};
+
+    bool ok;
+    if (options.body) {
+        ok = render_body(&options, output, &sample_rate, &stats);
+    } else if (is_midi_file(options.input_path)) {
+        ok = render_synth(&options, output, &sample_rate, &stats);
+    } else {
+        ok = render_effect(&options, output, &sample_rate, &stats);
+    }
+    if (!ok) return 1;
+
+    const uint64_t num_frames = output.size() / 2;
+    print_levels(output);
+    if (options.bench) {
+        bench_report(&stats, num_frames, sample_rate, options.block_size);
+    }
+
+    if (options.output_path &&
+        !wav_write(options.output_path, output.data(), (uint32_t)num_frames, 2, sample_rate)) {
+        return 1;
+    }
+
+    return 0;
+}